@@ -155,6 +155,20 @@ private Q_SLOTS:
         QCOMPARE(customRgba.alpha(), 255);
     }
 
+    void testFolded()
+    {
+        auto constant = Color::mix(Color::add(Color::rgba(100, 0, 0, 255), Color::rgba(100, 0, 0, 0)), Color::rgba(0, 200, 0, 255), 0.5);
+        auto folded = constant.folded();
+        QCOMPARE(folded.type(), ColorData::Type::RGBA);
+        QCOMPARE(folded, constant.toRgba());
+
+        auto custom = Color::mix(Color::add(Color::rgba(100, 0, 0, 255), Color::rgba(100, 0, 0, 0)), Color::custom(u"test"_s, {u"green"_s}), 0.5);
+        auto partial = custom.folded();
+        QCOMPARE(partial.type(), ColorData::Type::MixOperation);
+        QCOMPARE(partial.toRgba(), custom.toRgba());
+        QCOMPARE(partial, Color::mix(Color::rgba(200, 0, 0, 255), Color::custom(u"test"_s, {u"green"_s}), 0.5));
+    }
+
     void testCompare_data()
     {
         QTest::addColumn<Union::Color>("first");
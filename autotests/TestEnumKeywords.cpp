@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include <QtTest>
+
+#include <EnumKeywords.h>
+
+using namespace Union;
+using namespace Union::Properties;
+
+static_assert(enumFromKeyword<Alignment>("stack-center") == Alignment::StackCenter);
+static_assert(enumFromKeyword<Alignment>("Start") == Alignment::Start);
+static_assert(enumFromKeyword<TextWrapMode>("no-wrap") == TextWrapMode::NoWrap);
+static_assert(enumFromKeyword<Element::State>("hover") == Element::State::Hovered);
+static_assert(!enumFromKeyword<LineStyle>("dashed").has_value());
+static_assert(!enumFromKeyword<LineStyle>("").has_value());
+static_assert(enumFromKeyword<StyleRule::Condition>("right-to-left") == StyleRule::Condition::RightToLeft);
+
+// Ensure the keyword table contains an entry for every value of the enum.
+template<typename T, typename MetaType = T>
+void verifyComplete()
+{
+    const auto metaEnum = QMetaEnum::fromType<MetaType>();
+    QCOMPARE(qsizetype(EnumKeywords<T>::keywords.size()), qsizetype(metaEnum.keyCount()));
+
+    for (int i = 0; i < metaEnum.keyCount(); ++i) {
+        const auto key = QByteArray(metaEnum.key(i)).toLower().toStdString();
+        const auto value = enumFromKeyword<T>(key);
+        QVERIFY2(value.has_value(), metaEnum.key(i));
+        QCOMPARE(int(value.value()), metaEnum.value(i));
+    }
+}
+
+class TestEnumKeywords : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void testComplete()
+    {
+        verifyComplete<ImageFlag>();
+        verifyComplete<LineStyle>();
+        verifyComplete<AlignmentContainer>();
+        verifyComplete<Alignment>();
+        verifyComplete<TextWrapMode>();
+        verifyComplete<TextElide>();
+        verifyComplete<Element::State, Element::States>();
+        verifyComplete<Element::ColorSet>();
+        verifyComplete<StyleRule::Condition, StyleRule::Conditions>();
+    }
+};
+
+QTEST_MAIN(TestEnumKeywords)
+
+#include "TestEnumKeywords.moc"
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include <QtTest>
+
+#include <Length.h>
+
+using namespace Union;
+using namespace Qt::StringLiterals;
+
+class TestLength : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        Length::setContext(Length::Context{.fontPixelSize = 10.0, .dotsPerInch = 144.0});
+    }
+
+    void testToPixels()
+    {
+        QCOMPARE(Length(12.0).toPixels(), 12.0);
+        QCOMPARE(Length(12.0, Length::Unit::Points).toPixels(), 24.0);
+        QCOMPARE(Length(1.5, Length::Unit::Em).toPixels(), 15.0);
+        QCOMPARE(Length(2.0, Length::Unit::Rem).toPixels(), 20.0);
+
+        // Explicit conversion to qreal resolves the length.
+        auto pixels = qreal(Length(0.5, Length::Unit::Em));
+        QCOMPARE(pixels, 5.0);
+
+        static_assert(!std::is_convertible_v<Length, qreal>);
+    }
+
+    void testContext()
+    {
+        auto length = Length(2.0, Length::Unit::Em);
+        auto generation = Length::contextGeneration();
+
+        // Setting the same context should not invalidate anything.
+        QVERIFY(!Length::setContext(Length::context()));
+        QCOMPARE(Length::contextGeneration(), generation);
+
+        QVERIFY(Length::setContext(Length::Context{.fontPixelSize = 12.0, .dotsPerInch = 144.0}));
+        QCOMPARE(Length::contextGeneration(), generation + 1);
+        QCOMPARE(length.toPixels(), 24.0);
+
+        // An explicit context does not use the current context.
+        QCOMPARE(length.toPixels(Length::Context{.fontPixelSize = 8.0, .dotsPerInch = 96.0}), 16.0);
+
+        Length::setContext(Length::Context{.fontPixelSize = 10.0, .dotsPerInch = 144.0});
+    }
+
+    void testCompare()
+    {
+        // Lengths compare by value and unit, so they can be compared without
+        // resolving them.
+        QVERIFY(Length(1.0, Length::Unit::Em) == Length(1.0, Length::Unit::Em));
+        QVERIFY(Length(1.0, Length::Unit::Em) != Length(1.0, Length::Unit::Rem));
+        QVERIFY(Length(1.0, Length::Unit::Em) != Length(10.0));
+
+        // Comparing with qreal compares with a length in pixels, in either
+        // order, and never resolves relative units.
+        QVERIFY(Length(10.0) == 10.0);
+        QVERIFY(10.0 == Length(10.0));
+        QVERIFY(Length(1.0, Length::Unit::Em) != 10.0);
+        QVERIFY(10.0 != Length(1.0, Length::Unit::Em));
+    }
+
+    void testSerialize()
+    {
+        QByteArray data;
+        QDataStream writer(&data, QIODevice::WriteOnly);
+        writer << Length(1.5, Length::Unit::Points);
+
+        QDataStream reader(data);
+        Length result;
+        reader >> result;
+
+        QCOMPARE(result.value(), 1.5);
+        QCOMPARE(result.unit(), Length::Unit::Points);
+    }
+
+    void testToString()
+    {
+        QCOMPARE(Length(3.0).toString(), u"3px"_s);
+        QCOMPARE(Length(1.5, Length::Unit::Rem).toString(), u"1.5rem"_s);
+    }
+};
+
+QTEST_MAIN(TestLength)
+
+#include "TestLength.moc"
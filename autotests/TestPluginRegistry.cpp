@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include <QtTest>
+
+#include <PluginRegistry.h>
+
+using namespace Union;
+using namespace Qt::StringLiterals;
+
+namespace fs = std::filesystem;
+
+static bool createFile(const QTemporaryDir &dir, const QString &name)
+{
+    QFile file(dir.filePath(name));
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write("not a plugin");
+    return true;
+}
+
+class TestPluginRegistry : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+
+        const auto indexPath = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + u"/union/plugins.index"_s;
+        QFile::remove(indexPath);
+    }
+
+    void testIndex()
+    {
+        QTemporaryDir first;
+        QTemporaryDir second;
+        QVERIFY(first.isValid());
+        QVERIFY(second.isValid());
+
+        QVERIFY(createFile(first, u"one.so"_s));
+        QVERIFY(createFile(second, u"two.so"_s));
+        QVERIFY(createFile(second, u"three.so"_s));
+
+        const QList<fs::path> directories = {fs::path(first.path().toStdString()), fs::path(second.path().toStdString())};
+
+        auto entries = detail::pluginMetaData(directories);
+        QCOMPARE(entries.size(), 3);
+
+        // The index is written once all directories have been scanned.
+        const auto indexPath = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + u"/union/plugins.index"_s;
+        QVERIFY(QFile::exists(indexPath));
+
+        // Adding a file without changing the modification time of the
+        // directory should return the indexed data without scanning.
+        const auto modificationTime = fs::last_write_time(directories.at(1));
+        QVERIFY(createFile(second, u"four.so"_s));
+        fs::last_write_time(directories.at(1), modificationTime);
+
+        entries = detail::pluginMetaData(directories);
+        QCOMPARE(entries.size(), 3);
+
+        // Once the modification time of the directory changes, it should be
+        // scanned again.
+        fs::last_write_time(directories.at(1), modificationTime + std::chrono::seconds(10));
+
+        entries = detail::pluginMetaData(directories);
+        QCOMPARE(entries.size(), 4);
+
+        // Directories that do not exist are skipped.
+        entries = detail::pluginMetaData({fs::path(first.filePath(u"missing"_s).toStdString())});
+        QVERIFY(entries.isEmpty());
+    }
+};
+
+QTEST_MAIN(TestPluginRegistry)
+
+#include "TestPluginRegistry.moc"
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <optional>
+
+#include <Selector.h>
+#include <StyleRule.h>
+#include <properties/DisplayPropertyGroup.h>
+#include <properties/StylePropertyGroup.h>
+
+// Helpers for creating style rules in tests.
+
+// Creates a rule matching id that sets opacity, or a rule without properties
+// if opacity is not set.
+inline Union::StyleRule::Ptr createRule(const QString &id, std::optional<qreal> opacity)
+{
+    auto rule = Union::StyleRule::create();
+    rule->setSelectors({Union::Selector::create<Union::SelectorType::Id>(id)});
+    if (opacity) {
+        auto properties = std::make_unique<Union::Properties::StylePropertyGroup>();
+        auto display = std::make_unique<Union::Properties::DisplayPropertyGroup>();
+        display->setOpacity(opacity.value());
+        properties->setDisplay(std::move(display));
+        rule->setProperties(std::move(properties));
+    }
+    return rule;
+}
+
+// Creates a rule matching id with a display group setting visible and opacity.
+inline Union::StyleRule::Ptr createRule(const QString &id, std::optional<bool> visible, std::optional<qreal> opacity)
+{
+    auto rule = Union::StyleRule::create();
+    rule->setSelectors({Union::Selector::create<Union::SelectorType::Id>(id)});
+    auto properties = std::make_unique<Union::Properties::StylePropertyGroup>();
+    auto display = std::make_unique<Union::Properties::DisplayPropertyGroup>();
+    display->setVisible(visible);
+    display->setOpacity(opacity);
+    properties->setDisplay(std::move(display));
+    rule->setProperties(std::move(properties));
+    return rule;
+}
@@ -6,6 +6,7 @@
 #include <QtTest>
 
 #include <Element.h>
+#include <Length.h>
 #include <Selector.h>
 
 using namespace Union;
@@ -284,6 +285,107 @@ private Q_SLOTS:
 
         emptySelector = Selector::create<SelectorType::AttributeSubstringMatch>(std::make_pair(QString{}, QString{}));
         QVERIFY2(!emptySelector.matches(emptyElement.get()), "Empty Attribute Substring Match selector should not match an empty element");
+
+        emptySelector = Selector::create<SelectorType::AttributeIncludes>(std::make_pair(QString{}, QString{}));
+        QVERIFY2(!emptySelector.matches(emptyElement.get()), "Empty Attribute Includes selector should not match an empty element");
+
+        emptySelector = Selector::create<SelectorType::AttributePrefixMatch>(std::make_pair(QString{}, QString{}));
+        QVERIFY2(!emptySelector.matches(emptyElement.get()), "Empty Attribute Prefix Match selector should not match an empty element");
+
+        emptySelector = Selector::create<SelectorType::AttributeSuffixMatch>(std::make_pair(QString{}, QString{}));
+        QVERIFY2(!emptySelector.matches(emptyElement.get()), "Empty Attribute Suffix Match selector should not match an empty element");
+
+        emptySelector = Selector::create<SelectorType::AttributeDashMatch>(std::make_pair(QString{}, QString{}));
+        QVERIFY2(!emptySelector.matches(emptyElement.get()), "Empty Attribute Dash Match selector should not match an empty element");
+    }
+
+    void testAttributeMatches_data()
+    {
+        QTest::addColumn<SelectorList>("selectors");
+        QTest::addColumn<QVariant>("value");
+        QTest::addColumn<bool>("expected");
+
+        auto includes = SelectorList{Selector::create<SelectorType::AttributeIncludes>(std::make_pair(u"test"_s, u"word"_s))};
+        QTest::addRow("includes") << includes << QVariant(u"some word here"_s) << true;
+        QTest::addRow("includes case") << includes << QVariant(u"WORD"_s) << true;
+        QTest::addRow("includes partial") << includes << QVariant(u"words"_s) << false;
+        QTest::addRow("includes tab") << includes << QVariant(u"some\tword"_s) << true;
+        QTest::addRow("includes newline") << includes << QVariant(u"some\nword\r\nhere"_s) << true;
+        QTest::addRow("includes form feed") << includes << QVariant(u"some\fword"_s) << true;
+
+        auto includesSpace = SelectorList{Selector::create<SelectorType::AttributeIncludes>(std::make_pair(u"test"_s, u"some word"_s))};
+        QTest::addRow("includes operand whitespace") << includesSpace << QVariant(u"some word"_s) << false;
+
+        auto prefix = SelectorList{Selector::create<SelectorType::AttributePrefixMatch>(std::make_pair(u"test"_s, u"val"_s))};
+        QTest::addRow("prefix") << prefix << QVariant(u"value"_s) << true;
+        QTest::addRow("prefix middle") << prefix << QVariant(u"interval"_s) << false;
+
+        auto prefixCase = SelectorList{Selector::create<SelectorType::AttributePrefixMatch>(std::make_pair(u"test"_s, u"VaL"_s))};
+        QTest::addRow("prefix operand case") << prefixCase << QVariant(u"vALue"_s) << true;
+
+        auto includesCase = SelectorList{Selector::create<SelectorType::AttributeIncludes>(std::make_pair(u"test"_s, u"Word"_s))};
+        QTest::addRow("includes operand case") << includesCase << QVariant(u"some WORD"_s) << true;
+
+        auto suffix = SelectorList{Selector::create<SelectorType::AttributeSuffixMatch>(std::make_pair(u"test"_s, u"lue"_s))};
+        QTest::addRow("suffix") << suffix << QVariant(u"value"_s) << true;
+        QTest::addRow("suffix middle") << suffix << QVariant(u"values"_s) << false;
+
+        auto dash = SelectorList{Selector::create<SelectorType::AttributeDashMatch>(std::make_pair(u"test"_s, u"en"_s))};
+        QTest::addRow("dash exact") << dash << QVariant(u"en"_s) << true;
+        QTest::addRow("dash prefix") << dash << QVariant(u"en-US"_s) << true;
+        QTest::addRow("dash no dash") << dash << QVariant(u"english"_s) << false;
+
+        auto number = SelectorList{Selector::create<SelectorType::AttributePrefixMatch>(std::make_pair(u"test"_s, u"12"_s))};
+        QTest::addRow("number") << number << QVariant(123) << true;
+
+        // Lengths are resolved when matching, using the current context.
+        auto length = SelectorList{
+            Selector::create<SelectorType::AttributeEquals>(std::make_pair(u"test"_s, QVariant::fromValue(Length(2.0, Length::Unit::Em))))};
+        QTest::addRow("length") << length << QVariant(Length::context().fontPixelSize * 2.0) << true;
+        QTest::addRow("length other") << length << QVariant(2.0) << false;
+    }
+
+    void testAttributeMatches()
+    {
+        QFETCH(SelectorList, selectors);
+        QFETCH(QVariant, value);
+        QFETCH(bool, expected);
+
+        auto element = Element::create();
+        QVERIFY(!selectors.first().matches(element.get()));
+
+        element->setAttribute(u"test"_s, value);
+        QCOMPARE(selectors.first().matches(element.get()), expected);
+    }
+
+    void testStructuralMatches_data()
+    {
+        QTest::addColumn<SelectorList>("selectors");
+        QTest::addColumn<QList<int>>("expected");
+
+        QTest::addRow("first") << SelectorList{Selector::create<SelectorType::FirstChild>()} << QList<int>{0};
+        QTest::addRow("last") << SelectorList{Selector::create<SelectorType::LastChild>()} << QList<int>{4};
+        QTest::addRow("odd") << SelectorList{Selector::create<SelectorType::NthChild>(std::make_pair(2, 1))} << QList<int>{0, 2, 4};
+        QTest::addRow("first three") << SelectorList{Selector::create<SelectorType::NthChild>(std::make_pair(-1, 3))} << QList<int>{0, 1, 2};
+        QTest::addRow("second to last") << SelectorList{Selector::create<SelectorType::NthLastChild>(std::make_pair(0, 2))} << QList<int>{3};
+    }
+
+    void testStructuralMatches()
+    {
+        QFETCH(SelectorList, selectors);
+        QFETCH(QList<int>, expected);
+
+        auto element = Element::create();
+        QVERIFY(!selectors.first().matches(element.get()));
+
+        QList<int> matched;
+        for (int i = 0; i < 5; ++i) {
+            element->setPosition(i, 5);
+            if (selectors.first().matches(element.get())) {
+                matched.append(i);
+            }
+        }
+        QCOMPARE(matched, expected);
     }
 
     void testSelectors_data()
@@ -329,6 +431,14 @@ private Q_SLOTS:
             Selector::create<SelectorType::AttributeExists>(u"attribute"_s),
             Selector::create<SelectorType::AttributeEquals>(std::pair(u"attribute"_s, QVariant::fromValue(1.234))),
             Selector::create<SelectorType::AttributeSubstringMatch>(std::pair(u"other-attribute"_s, u"val"_s)),
+            Selector::create<SelectorType::AttributeIncludes>(std::pair(u"other-attribute"_s, u"word"_s)),
+            Selector::create<SelectorType::AttributePrefixMatch>(std::pair(u"other-attribute"_s, u"prefix"_s)),
+            Selector::create<SelectorType::AttributeSuffixMatch>(std::pair(u"other-attribute"_s, u"suffix"_s)),
+            Selector::create<SelectorType::AttributeDashMatch>(std::pair(u"other-attribute"_s, u"dash"_s)),
+            Selector::create<SelectorType::FirstChild>(),
+            Selector::create<SelectorType::LastChild>(),
+            Selector::create<SelectorType::NthChild>(std::pair(2, 1)),
+            Selector::create<SelectorType::NthLastChild>(std::pair(-1, 3)),
             Selector::create<SelectorType::ChildCombinator>(),
             Selector::create<SelectorType::AnyElement>(),
         };
@@ -369,6 +479,8 @@ private Q_SLOTS:
                                                  Selector::create<SelectorType::AttributeEquals>(std::make_pair(u"test"_s, QVariant::fromValue(u"value"_s)))};
         QTest::addRow("attribute_substring") << attribute
                                              << SelectorList{Selector::create<SelectorType::AttributeSubstringMatch>(std::make_pair(u"test"_s, (u"lu"_s)))};
+        QTest::addRow("attribute_prefix") << attribute
+                                          << SelectorList{Selector::create<SelectorType::AttributePrefixMatch>(std::make_pair(u"test"_s, (u"va"_s)))};
 
         auto structure = QJsonArray{
             QJsonObject{{u"type"_s, u"test"_s}},
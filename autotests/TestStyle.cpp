@@ -3,9 +3,12 @@
 
 #include <QtTest>
 
+#include <ElementQuery.h>
 #include <Style.h>
 #include <StyleLoader.h>
 
+#include "TestRules.h"
+
 using namespace Union;
 using namespace Qt::StringLiterals;
 
@@ -20,6 +23,32 @@ struct TestLoader : public StyleLoader {
     }
 };
 
+struct RulesLoader : public StyleLoader {
+    bool load(std::shared_ptr<Style> style) override
+    {
+        for (const auto &rule : std::as_const(rules)) {
+            style->insert(rule);
+        }
+        return true;
+    }
+
+    QList<StyleRule::Ptr> rules;
+};
+
+class StyleChangedSpy : public QObject
+{
+public:
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        if (event->type() == StyleChangedEvent::s_type) {
+            events.append(static_cast<StyleChangedEvent *>(event)->changedSelectors());
+        }
+        return QObject::eventFilter(watched, event);
+    }
+
+    QList<QList<SelectorList>> events;
+};
+
 class TestStyle : public QObject
 {
     Q_OBJECT
@@ -56,6 +85,206 @@ private Q_SLOTS:
         result = style->matches(elements);
         QCOMPARE(result.size(), 0);
     }
+
+    void testReplaceRules()
+    {
+        auto style = Style::create(u"test"_s, u"test"_s, std::make_unique<TestLoader>());
+        style->insert(createRule(u"unchanged"_s, 1.0));
+        style->insert(createRule(u"changed"_s, 1.0));
+        style->insert(createRule(u"removed"_s, std::nullopt));
+
+        StyleChangedSpy spy;
+        style->installEventFilter(&spy);
+
+        auto other = Style::create(u"test"_s, u"test"_s, std::make_unique<TestLoader>());
+        other->insert(createRule(u"unchanged"_s, 1.0));
+        other->insert(createRule(u"changed"_s, 0.5));
+        other->insert(createRule(u"added"_s, std::nullopt));
+
+        style->replaceRules(other);
+
+        QCOMPARE(style->rules(), other->rules());
+        QCOMPARE(spy.events.size(), 1);
+
+        QStringList changed;
+        for (const auto &selectors : std::as_const(spy.events.first())) {
+            changed.append(selectors.toString());
+        }
+        changed.sort();
+
+        QStringList expected{
+            SelectorList{Selector::create<SelectorType::Id>(u"added"_s)}.toString(),
+            SelectorList{Selector::create<SelectorType::Id>(u"changed"_s)}.toString(),
+            SelectorList{Selector::create<SelectorType::Id>(u"removed"_s)}.toString(),
+        };
+        expected.sort();
+        QCOMPARE(changed, expected);
+
+        // Replacing with identical rules should not send any event.
+        auto identical = Style::create(u"test"_s, u"test"_s, std::make_unique<TestLoader>());
+        identical->insert(createRule(u"unchanged"_s, 1.0));
+        identical->insert(createRule(u"changed"_s, 0.5));
+        identical->insert(createRule(u"added"_s, std::nullopt));
+
+        style->replaceRules(identical);
+        QCOMPARE(spy.events.size(), 1);
+    }
+
+    void testOptimizeRules()
+    {
+        auto loader = std::make_unique<RulesLoader>();
+        // Merged, as nothing of the same weight is in between.
+        loader->rules.append(createRule(u"merged"_s, true, std::nullopt));
+        loader->rules.append(createRule(u"merged"_s, std::nullopt, 0.5));
+        // Not merged, as "other" has the same weight and is in between.
+        loader->rules.append(createRule(u"separate"_s, true, std::nullopt));
+        loader->rules.append(createRule(u"other"_s, true, std::nullopt));
+        loader->rules.append(createRule(u"separate"_s, std::nullopt, 0.5));
+        // Dropped, as a later rule sets the same properties. This also drops
+        // the first "other" rule.
+        loader->rules.append(createRule(u"shadowed"_s, true, std::nullopt));
+        loader->rules.append(createRule(u"other"_s, false, std::nullopt));
+        loader->rules.append(createRule(u"shadowed"_s, false, 0.5));
+
+        auto style = Style::create(u"test"_s, u"test"_s, std::move(loader));
+        QVERIFY(style->load());
+
+        const auto rules = style->rules();
+        QCOMPARE(rules.size(), 5);
+
+        auto selectorsOf = [](const QString &id) {
+            return SelectorList{Selector::create<SelectorType::Id>(id)}.toString();
+        };
+
+        QCOMPARE(rules.at(0)->selectors().toString(), selectorsOf(u"merged"_s));
+        QCOMPARE(rules.at(0)->properties()->display()->visible(), true);
+        QCOMPARE(rules.at(0)->properties()->display()->opacity(), 0.5);
+
+        QCOMPARE(rules.at(1)->selectors().toString(), selectorsOf(u"separate"_s));
+        QCOMPARE(rules.at(2)->selectors().toString(), selectorsOf(u"separate"_s));
+        QCOMPARE(rules.at(3)->selectors().toString(), selectorsOf(u"other"_s));
+        QCOMPARE(rules.at(3)->properties()->display()->visible(), false);
+        QCOMPARE(rules.at(4)->selectors().toString(), selectorsOf(u"shadowed"_s));
+        QCOMPARE(rules.at(4)->properties()->display()->opacity(), 0.5);
+    }
+
+    void testSiblingPosition()
+    {
+        auto loader = std::make_unique<RulesLoader>();
+        auto style = Style::create(u"test"_s, u"test"_s, std::move(loader));
+        QVERIFY(style->load());
+
+        // Without structural selectors, the position does not matter.
+        QCOMPARE(style->siblingPosition(3, 10), std::make_pair(-1, 0));
+
+        auto first = StyleRule::create();
+        first->setSelectors({Selector::create<SelectorType::FirstChild>()});
+        style->insert(first);
+
+        QCOMPARE(style->siblingPosition(0, 10), std::make_pair(0, 0));
+        QCOMPARE(style->siblingPosition(3, 10), style->siblingPosition(5, 11));
+
+        auto last = StyleRule::create();
+        last->setSelectors({Selector::create<SelectorType::LastChild>()});
+        style->insert(last);
+
+        QCOMPARE(style->siblingPosition(3, 10), style->siblingPosition(5, 11));
+        QVERIFY(style->siblingPosition(9, 10) != style->siblingPosition(5, 10));
+        QVERIFY(style->siblingPosition(0, 10) != style->siblingPosition(0, 1));
+
+        auto nth = StyleRule::create();
+        nth->setSelectors({Selector::create<SelectorType::NthChild>(std::make_pair(2, 0))});
+        style->insert(nth);
+
+        QVERIFY(style->siblingPosition(3, 10) != style->siblingPosition(5, 10));
+        QCOMPARE(style->siblingPosition(3, 10), style->siblingPosition(3, 11));
+    }
+
+    void testConditions()
+    {
+        using enum StyleRule::Condition;
+
+        auto style = Style::create(u"test"_s, u"test"_s, std::make_unique<TestLoader>());
+        QVERIFY(style->load());
+
+        auto rightToLeft = createRule(u"test"_s, 0.5);
+        rightToLeft->setConditions(RightToLeft);
+        style->insert(rightToLeft);
+
+        auto mobileRightToLeft = createRule(u"test"_s, 0.25);
+        mobileRightToLeft->setConditions(Mobile | RightToLeft);
+        style->insert(mobileRightToLeft);
+
+        StyleChangedSpy spy;
+        style->installEventFilter(&spy);
+
+        auto element = Element::create();
+        element->setId(u"test"_s);
+        const QList<Element::Ptr> elements{element};
+
+        QCOMPARE(style->matches(elements).size(), 1);
+
+        style->setConditions(Desktop | RightToLeft | StandardMotion | StandardContrast);
+        QCOMPARE(style->matches(elements).size(), 2);
+        QCOMPARE(spy.events.size(), 1);
+        QCOMPARE(spy.events.first().size(), 1);
+
+        style->setConditions(Mobile | RightToLeft | StandardMotion | StandardContrast);
+        QCOMPARE(style->matches(elements).size(), 3);
+        QCOMPARE(spy.events.size(), 2);
+
+        // Changing a condition that no rule depends on should not send an event.
+        style->setConditions(Mobile | RightToLeft | ReducedMotion | StandardContrast);
+        QCOMPARE(style->matches(elements).size(), 3);
+        QCOMPARE(spy.events.size(), 2);
+    }
+
+    void testPrewarm()
+    {
+        auto style = Style::create(u"test"_s, u"test"_s, std::make_unique<TestLoader>());
+        QVERIFY(style->load());
+
+        auto parent = Element::create();
+        parent->setType(u"ToolBar"_s);
+        parent->setColorSet(Element::ColorSet::Window);
+
+        auto element = Element::create();
+        element->setId(u"test"_s);
+        element->setStates(Element::State::Hovered | Element::State::Pressed);
+        element->setHints({u"flat"_s});
+        element->setAttributes({{u"display"_s, u"icon"_s}});
+
+        QTemporaryDir dir;
+        const auto path = std::filesystem::path(dir.filePath(u"chains.json"_s).toStdString());
+        QVERIFY(ElementQuery::writeChains(path, {{parent, element}}));
+
+        const auto chains = ElementQuery::readChains(path);
+        QCOMPARE(chains.size(), 1);
+        QCOMPARE(chains.first().size(), 2);
+        QCOMPARE(elementListCacheKey(chains.first()), elementListCacheKey({parent, element}));
+
+        ElementQuery::clearCache();
+        QVERIFY(!ElementQuery::isCached({parent, element}));
+
+        // Results computed before the cache gets cleared should be discarded.
+        // The results are inserted from the event loop, so this always clears
+        // before they are inserted.
+        auto discarded = ElementQuery::prewarm(style, chains);
+        ElementQuery::clearCache();
+        QTRY_VERIFY(discarded.isFinished());
+        QVERIFY(!ElementQuery::isCached({parent, element}));
+
+        auto future = ElementQuery::prewarm(style, chains);
+        QTRY_VERIFY(future.isFinished());
+
+        // The query should now be answered from the cache.
+        QVERIFY(ElementQuery::isCached({parent, element}));
+
+        ElementQuery query(style);
+        query.setElements(chains.first());
+        QVERIFY(query.execute());
+        QVERIFY(query.hasMatches());
+    }
 };
 
 QTEST_MAIN(TestStyle)
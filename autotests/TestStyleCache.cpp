@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include <QtTest>
+
+#include <StyleCache_p.h>
+#include <Style_p.h>
+
+#include "TestRules.h"
+
+using namespace Union;
+using namespace Qt::StringLiterals;
+
+namespace fs = std::filesystem;
+
+class TestStyleCache : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        QVERIFY(m_sourceDir.isValid());
+
+        m_sourceFile = fs::path(m_sourceDir.filePath(u"style.css"_s).toStdString());
+        QFile file(m_sourceFile);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("/* test */");
+        file.close();
+    }
+
+    void cleanup()
+    {
+        qunsetenv("UNION_STYLE_CACHE_DISABLE_MMAP");
+        qunsetenv("UNION_STYLE_CACHE_VALIDATION");
+    }
+
+    void testPayloadRoundTrip_data()
+    {
+        QTest::addColumn<bool>("mapped");
+
+        QTest::newRow("mapped") << true;
+        QTest::newRow("read") << false;
+    }
+
+    void testPayloadRoundTrip()
+    {
+        QFETCH(bool, mapped);
+
+        if (!mapped) {
+            qputenv("UNION_STYLE_CACHE_DISABLE_MMAP", "1");
+        }
+
+        StyleCache cache;
+        QVERIFY(cache.enabled());
+
+        StylePrivate style;
+        style.pluginName = u"test"_s;
+        style.styleName = u"payload"_s;
+        style.cachePaths = {m_sourceFile};
+        style.modificationTimes = {fs::last_write_time(m_sourceFile)};
+        style.rules = {
+            createRule(u"first"_s, 0.5),
+            createRule(u"empty"_s, std::nullopt),
+            createRule(u"second"_s, 0.25),
+        };
+
+        QVERIFY(cache.save(&style));
+        QVERIFY(cache.hasEntry({"test", "payload"}));
+
+        auto loaded = cache.load({"test", "payload"});
+        QVERIFY(loaded);
+        QCOMPARE(loaded->rules.size(), 3);
+
+        for (qsizetype i = 0; i < style.rules.size(); ++i) {
+            QCOMPARE(loaded->rules.at(i)->selectors().toString(), style.rules.at(i)->selectors().toString());
+        }
+
+        QCOMPARE(loaded->rules.at(0)->properties()->display()->opacity(), 0.5);
+        QVERIFY(!loaded->rules.at(1)->properties());
+        QCOMPARE(loaded->rules.at(2)->properties()->display()->opacity(), 0.25);
+    }
+
+    void testManifestValidation()
+    {
+        qputenv("UNION_STYLE_CACHE_VALIDATION", "manifest");
+
+        QTemporaryDir sourceDir;
+        QVERIFY(sourceDir.isValid());
+
+        const auto sourceFile = fs::path(sourceDir.filePath(u"style.css"_s).toStdString());
+        QFile file(sourceFile);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("/* test */");
+        file.close();
+
+        StyleCache cache;
+        QCOMPARE(cache.validationMode(), StyleCache::ValidationMode::Manifest);
+
+        StylePrivate style;
+        style.pluginName = u"test"_s;
+        style.styleName = u"manifest"_s;
+        style.cachePaths = {sourceFile};
+        style.modificationTimes = {fs::last_write_time(sourceFile)};
+        style.rules = {createRule(u"first"_s, 0.5)};
+
+        QVERIFY(cache.save(&style));
+        QVERIFY(cache.load({"test", "manifest"}));
+
+        // Files modified in place are intentionally not detected in manifest
+        // mode, only the directory containing them is checked.
+        fs::last_write_time(sourceFile, fs::last_write_time(sourceFile) + std::chrono::seconds(10));
+        QVERIFY(cache.load({"test", "manifest"}));
+
+        // Replacing a file or adding a new one changes the modification time
+        // of the directory, which should invalidate the cached data.
+        const auto directory = sourceFile.parent_path();
+        fs::last_write_time(directory, fs::last_write_time(directory) + std::chrono::seconds(10));
+        QVERIFY(!cache.load({"test", "manifest"}));
+
+        // Saving again should make the cached data valid again.
+        QVERIFY(cache.save(&style));
+        QVERIFY(cache.load({"test", "manifest"}));
+
+        // A removed source directory also invalidates the cached data.
+        QVERIFY(sourceDir.remove());
+        QVERIFY(!cache.load({"test", "manifest"}));
+    }
+
+private:
+    QTemporaryDir m_sourceDir;
+    fs::path m_sourceFile;
+};
+
+QTEST_MAIN(TestStyleCache)
+
+#include "TestStyleCache.moc"
@@ -3,16 +3,94 @@
 
 #include <QtTest>
 
+#include <Style.h>
+#include <StyleCache_p.h>
 #include <StyleRegistry.h>
+#include <Style_p.h>
 
 using namespace Union;
 using namespace Qt::StringLiterals;
 
+namespace fs = std::filesystem;
+
 class TestStyleRegistry : public QObject
 {
     Q_OBJECT
 private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+    }
+
     // TODO: Test plugin loading functionality
+
+    void testStyleAsync()
+    {
+        auto registry = StyleRegistry::instance();
+
+        auto style = Style::create(u"test"_s, u"async"_s, nullptr);
+        registry->addStyle(style);
+
+        auto future = registry->styleAsync(u"async"_s, u"test"_s);
+        future.waitForFinished();
+
+        QVERIFY(future.result() == style);
+        QVERIFY(registry->style(u"async"_s, u"test"_s) == style);
+    }
+
+    void testStyleAsyncConcurrent()
+    {
+        QTemporaryDir sourceDir;
+        QVERIFY(sourceDir.isValid());
+
+        const auto sourceFile = fs::path(sourceDir.filePath(u"style.css"_s).toStdString());
+        QFile file(sourceFile);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("/* test */");
+        file.close();
+
+        // Write cache entries for a few styles so the registry can load them
+        // without needing an input plugin.
+        StyleCache cache;
+        QVERIFY(cache.enabled());
+
+        const QStringList styleNames = {u"concurrent-1"_s, u"concurrent-2"_s, u"concurrent-3"_s};
+        for (const auto &name : styleNames) {
+            StylePrivate style;
+            style.pluginName = u"test"_s;
+            style.styleName = name;
+            style.cachePaths = {sourceFile};
+            style.modificationTimes = {fs::last_write_time(sourceFile)};
+            auto rule = StyleRule::create();
+            rule->setSelectors({Selector::create<SelectorType::Id>(name)});
+            style.rules = {rule};
+            QVERIFY(cache.save(&style));
+        }
+
+        auto registry = StyleRegistry::instance();
+
+        // Request every style several times at once, both the same style and
+        // different styles are loaded concurrently.
+        QList<std::pair<QString, QFuture<Style::Ptr>>> futures;
+        for (int i = 0; i < 4; ++i) {
+            for (const auto &name : styleNames) {
+                futures.append(std::make_pair(name, registry->styleAsync(name, u"test"_s)));
+            }
+        }
+
+        for (auto &[name, future] : futures) {
+            future.waitForFinished();
+
+            auto style = future.result();
+            QVERIFY(style);
+            QCOMPARE(style->name(), name);
+            QCOMPARE(style->rules().size(), 1);
+
+            // Concurrent requests for the same style should all result in the
+            // same instance.
+            QVERIFY(registry->style(name, u"test"_s) == style);
+        }
+    }
 };
 
 QTEST_MAIN(TestStyleRegistry)
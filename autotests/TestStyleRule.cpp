@@ -78,6 +78,36 @@ private Q_SLOTS:
         //
         // QCOMPARE(style->boundingRect(), QRectF(0, 0, 20, 20));
     }
+
+    void testPropertiesLoader()
+    {
+        auto rule = StyleRule::create();
+
+        int loadCount = 0;
+        rule->setPropertiesLoader([&loadCount]() {
+            loadCount++;
+            auto properties = std::make_unique<Properties::StylePropertyGroup>();
+            auto display = std::make_unique<Properties::DisplayPropertyGroup>();
+            display->setOpacity(0.5);
+            properties->setDisplay(std::move(display));
+            return properties;
+        });
+
+        QCOMPARE(loadCount, 0);
+
+        QVERIFY(rule->properties());
+        QCOMPARE(rule->properties()->display()->opacity().value(), 0.5);
+        QCOMPARE(loadCount, 1);
+
+        rule->setPropertiesLoader([&loadCount]() {
+            loadCount++;
+            return std::make_unique<Properties::StylePropertyGroup>();
+        });
+        rule->setProperties(nullptr);
+
+        QVERIFY(!rule->properties());
+        QCOMPARE(loadCount, 1);
+    }
 };
 
 QTEST_MAIN(TestStyleRule)
@@ -5,13 +5,22 @@
 
 #include <QStandardPaths>
 
+#include <Element.h>
+#include <ElementQuery.h>
+#include <Length.h>
 #include <Style.h>
+#include <StyleRegistry.h>
+#include <properties/LayoutPropertyGroup.h>
+#include <properties/StylePropertyGroup.h>
 
 #include <CssParser.h>
+#include <CssPreprocessor.h>
+#include <CssPseudoClass.h>
 
 namespace fs = std::filesystem;
 
 using namespace Union;
+using namespace Union::Properties;
 using namespace Qt::StringLiterals;
 using namespace std::string_literals;
 
@@ -34,8 +43,22 @@ private Q_SLOTS:
 
         auto cssInputPath = fs::path(QFINDTESTDATA("../../src/input/css/").toStdString());
 
-        cssparser::StyleSheet styleSheet(cssInputPath / "styles"s / styleName / "style.css"s);
-        styleSheet.import(cssInputPath / "defaults"s / "default.css"s);
+        const auto stylePath = cssInputPath / "styles"s / styleName / "style.css"s;
+        const auto defaultsPath = cssInputPath / "defaults"s / "default.css"s;
+
+        QTemporaryDir processedDir;
+        CssPreprocessor preprocessor(fs::path(processedDir.path().toStdString()));
+        preprocessor.addFile(defaultsPath);
+        preprocessor.addFile(stylePath);
+        QVERIFY(preprocessor.process());
+
+        for (const auto &error : preprocessor.errors()) {
+            qWarning() << error.file.c_str() << error.line << error.message.c_str();
+        }
+        QVERIFY(preprocessor.errors().empty());
+
+        cssparser::StyleSheet styleSheet(preprocessor.outputPath(stylePath));
+        styleSheet.import(preprocessor.outputPath(defaultsPath));
         styleSheet.parse();
 
         if (styleSheet.errors().size() > 0) {
@@ -47,6 +70,197 @@ private Q_SLOTS:
             QFAIL("Parsing stylesheet produced errors!");
         }
     }
+
+    void testScopedCustomProperties()
+    {
+        // Styles are located in the data directories, which in test mode only
+        // contain the writable test location.
+        QStandardPaths::setTestModeEnabled(true);
+
+        const QDir dataDir(QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation) + u"/union/css"_s);
+        QVERIFY(dataDir.mkpath(u"defaults"_s));
+        QVERIFY(dataDir.mkpath(u"styles/scoped"_s));
+
+        writeFile(dataDir.filePath(u"defaults/default.css"_s), "");
+        writeFile(dataDir.filePath(u"styles/scoped/variables.css"_s), R"(
+            :root {
+                --spacing: 2px;
+            }
+        )");
+        writeFile(dataDir.filePath(u"styles/scoped/style.css"_s), R"(
+            @import "variables.css";
+
+            toolbar {
+                --spacing: 4px;
+            }
+
+            button {
+                spacing: var(--spacing);
+
+                &.flat {
+                    --spacing: 6px;
+                    spacing: var(--spacing);
+                }
+            }
+
+            toolbar button {
+                width: calc(var(--spacing) * 2);
+            }
+
+            toolbar label, label {
+                height: var(--spacing);
+            }
+        )");
+
+        auto registry = StyleRegistry::instance();
+        registry->load();
+        auto style = registry->style(u"scoped"_s, u"css"_s);
+        QVERIFY(style);
+        QVERIFY(!style->hasErrors());
+
+        ElementQuery::clearCache();
+
+        const auto button = createElement(u"button"_s);
+        const auto flatButton = createElement(u"button"_s, {u"flat"_s});
+        const auto label = createElement(u"label"_s);
+        const auto toolbar = createElement(u"toolbar"_s);
+
+        // Declarations on :root apply everywhere.
+        QCOMPARE(queryLayout(style, {button}, &LayoutPropertyGroup::spacing), std::optional(Length(2.0)));
+
+        // Nested rules use the declaration of the rule they are nested in.
+        QCOMPARE(queryLayout(style, {flatButton}, &LayoutPropertyGroup::spacing), std::optional(Length(6.0)));
+
+        // Rules with a selector containing the declaring selector use its
+        // declaration, including inside calc().
+        QCOMPARE(queryLayout(style, {button, toolbar}, &LayoutPropertyGroup::width), std::optional(Length(8.0)));
+
+        // Rules with multiple selectors resolve the value for each selector.
+        QCOMPARE(queryLayout(style, {label}, &LayoutPropertyGroup::height), std::optional(Length(2.0)));
+        QCOMPARE(queryLayout(style, {label, toolbar}, &LayoutPropertyGroup::height), std::optional(Length(4.0)));
+
+        // Properties are not inherited by elements, so a rule for button does
+        // not use the declaration on toolbar.
+        QCOMPARE(queryLayout(style, {button, toolbar}, &LayoutPropertyGroup::spacing), std::optional(Length(2.0)));
+    }
+
+    void testCalc_data()
+    {
+        QTest::addColumn<std::string>("input");
+        QTest::addColumn<std::optional<std::string>>("expected");
+
+        QTest::addRow("add") << "calc(2px + 3px)"s << std::make_optional("5px"s);
+        QTest::addRow("subtract") << "calc(2px - 3px)"s << std::make_optional("-1px"s);
+        QTest::addRow("multiply") << "calc(2 * 3pt)"s << std::make_optional("6pt"s);
+        QTest::addRow("divide") << "calc(9px / 2)"s << std::make_optional("4.5px"s);
+        QTest::addRow("precedence") << "calc(1px + 2px * 3)"s << std::make_optional("7px"s);
+        QTest::addRow("parentheses") << "calc((1px + 2px) * 3)"s << std::make_optional("9px"s);
+        QTest::addRow("nested") << "calc(calc(1em + 1em) / 4)"s << std::make_optional("0.5em"s);
+        QTest::addRow("negative") << "calc(-2px * -1)"s << std::make_optional("2px"s);
+        QTest::addRow("multiple") << "0px calc(1px + 1px) 0px calc(2px * 2)"s << std::make_optional("0px 2px 0px 4px"s);
+        QTest::addRow("no calc") << "1px solid red"s << std::make_optional("1px solid red"s);
+        QTest::addRow("mixed units") << "calc(1px + 1em)"s << std::optional<std::string>{};
+        QTest::addRow("multiply units") << "calc(1px * 1px)"s << std::optional<std::string>{};
+        QTest::addRow("divide by zero") << "calc(1px / 0)"s << std::optional<std::string>{};
+        QTest::addRow("invalid") << "calc(1px +)"s << std::optional<std::string>{};
+    }
+
+    void testCalc()
+    {
+        QFETCH(std::string, input);
+        QFETCH(std::optional<std::string>, expected);
+
+        QCOMPARE(CssPreprocessor::foldCalc(input), expected);
+    }
+
+    void testNth_data()
+    {
+        QTest::addColumn<std::string>("selector");
+        QTest::addColumn<std::optional<std::pair<int, int>>>("expected");
+
+        QTest::addRow("an+b") << "button:nth-child(2n+1)"s << std::make_optional(std::make_pair(2, 1));
+        QTest::addRow("an-b") << "button:nth-child(3n-2)"s << std::make_optional(std::make_pair(3, -2));
+        QTest::addRow("n") << "button:nth-child(n)"s << std::make_optional(std::make_pair(1, 0));
+        QTest::addRow("b") << "button:nth-child(3)"s << std::make_optional(std::make_pair(0, 3));
+        QTest::addRow("odd") << "button:nth-child(odd)"s << std::make_optional(std::make_pair(2, 1));
+        QTest::addRow("even") << "button:nth-child(even)"s << std::make_optional(std::make_pair(2, 0));
+        QTest::addRow("negative a") << "button:nth-child(-n+3)"s << std::make_optional(std::make_pair(-1, 3));
+        QTest::addRow("last an+b") << "button:nth-last-child(2n+1)"s << std::make_optional(std::make_pair(2, 1));
+        QTest::addRow("last odd") << "button:nth-last-child(odd)"s << std::make_optional(std::make_pair(2, 1));
+        QTest::addRow("last even") << "button:nth-last-child(even)"s << std::make_optional(std::make_pair(2, 0));
+        QTest::addRow("last negative a") << "button:nth-last-child(-2n+4)"s << std::make_optional(std::make_pair(-2, 4));
+    }
+
+    void testNth()
+    {
+        QFETCH(std::string, selector);
+        QFETCH(std::optional<std::pair<int, int>>, expected);
+
+        QTemporaryDir sourceDir;
+        QVERIFY(sourceDir.isValid());
+
+        writeFile(sourceDir.filePath(u"style.css"_s), QByteArray::fromStdString(selector + " { color: red; }"s));
+
+        cssparser::StyleSheet styleSheet(fs::path(sourceDir.filePath(u"style.css"_s).toStdString()));
+        styleSheet.parse();
+        QVERIFY(styleSheet.errors().empty());
+        QCOMPARE(styleSheet.rules().size(), std::size_t(1));
+
+        // The loader receives the whole pseudo-class, including its argument,
+        // as the value of the selector part.
+        const auto &parts = styleSheet.rules().front().selector().parts();
+        const auto pseudoClass = std::ranges::find_if(parts, [](const auto &part) {
+            return part.kind() == cssparser::SelectorPart::Kind::PseudoClass;
+        });
+        QVERIFY(pseudoClass != parts.end());
+
+        QCOMPARE(parse_nth(pseudo_class_argument(pseudoClass->value().get<std::string>())), expected);
+    }
+
+    void testNthInvalid_data()
+    {
+        QTest::addColumn<std::string>("argument");
+
+        QTest::addRow("empty") << ""s;
+        QTest::addRow("missing operator") << "2n1"s;
+        QTest::addRow("keyword") << "first"s;
+        QTest::addRow("trailing") << "2n+1x"s;
+    }
+
+    void testNthInvalid()
+    {
+        QFETCH(std::string, argument);
+
+        QVERIFY(!parse_nth(argument));
+    }
+
+private:
+    Element::Ptr createElement(const QString &type, const QStringList &hints = {})
+    {
+        auto element = Element::create();
+        element->setType(type);
+        element->setHints(hints);
+        return element;
+    }
+
+    // Returns the value of a layout property for elements, with the first
+    // element being the bottom-most one.
+    std::optional<Length> queryLayout(const Style::Ptr &style, const QList<Element::Ptr> &elements, std::optional<Length> (LayoutPropertyGroup::*getter)() const)
+    {
+        ElementQuery query(style);
+        query.setElements(elements);
+        if (!query.execute() || !query.properties() || !query.properties()->layout()) {
+            return std::nullopt;
+        }
+        return (query.properties()->layout()->*getter)();
+    }
+
+    void writeFile(const QString &path, const QByteArray &contents)
+    {
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(contents);
+    }
 };
 
 QTEST_MAIN(TestCss)
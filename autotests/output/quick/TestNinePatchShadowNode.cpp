@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include <QtTest>
+
+#include <QQuickWindow>
+#include <QSGImageNode>
+
+#include "NinePatchShadowNode.h"
+
+class TestNinePatchShadowNode : public QObject
+{
+    Q_OBJECT
+
+    std::unique_ptr<QQuickWindow> m_window;
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        // Use the software renderer, which custom materials do not support,
+        // so this also covers that the node works without them.
+        QQuickWindow::setGraphicsApi(QSGRendererInterface::Software);
+
+        m_window = std::make_unique<QQuickWindow>();
+        m_window->resize(200, 200);
+        m_window->show();
+        QVERIFY(QTest::qWaitForWindowExposed(m_window.get()));
+        QTRY_VERIFY(m_window->isSceneGraphInitialized());
+    }
+
+    void cleanupTestCase()
+    {
+        m_window.reset();
+    }
+
+    void testPatches()
+    {
+        NinePatchShadowNode node(m_window.get());
+        node.setItemRect(QRectF(10.0, 10.0, 100.0, 50.0));
+        node.setRadius(QVector4D(4.0, 4.0, 4.0, 4.0));
+        node.setBlur(5.0);
+        node.setSpread(2.0);
+        node.setOffset(QVector2D(1.0, 2.0));
+        node.setColor(Qt::black);
+        node.update();
+
+        QCOMPARE(node.childCount(), 9);
+
+        auto patch = [&node](int row, int column) {
+            return static_cast<QSGImageNode *>(node.childAtIndex(row * 3 + column));
+        };
+
+        const auto texture = patch(0, 0)->texture();
+        QVERIFY(texture);
+
+        // The texture contains the corners plus a single row and column.
+        const auto textureSize = texture->textureSize();
+        QCOMPARE(textureSize.width(), textureSize.height());
+        QCOMPARE(textureSize.width() % 2, 1);
+        const auto corner = (textureSize.width() - 1) / 2;
+
+        // The patches cover the item grown by spread and blur, moved by the
+        // offset, without gaps or overlap.
+        const auto expected = QRectF(10.0, 10.0, 100.0, 50.0).adjusted(-7.0, -7.0, 7.0, 7.0).translated(1.0, 2.0);
+
+        QRectF covered;
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 3; ++column) {
+                QCOMPARE(patch(row, column)->texture(), texture);
+                covered |= patch(row, column)->rect();
+            }
+
+            QCOMPARE(patch(row, 0)->rect().right(), patch(row, 1)->rect().left());
+            QCOMPARE(patch(row, 1)->rect().right(), patch(row, 2)->rect().left());
+            QCOMPARE(patch(0, row)->rect().bottom(), patch(1, row)->rect().top());
+            QCOMPARE(patch(1, row)->rect().bottom(), patch(2, row)->rect().top());
+        }
+        QCOMPARE(covered, expected);
+
+        // Corners are drawn at texture size, the middle is stretched from a
+        // single pixel.
+        QCOMPARE(patch(0, 0)->rect().size(), QSizeF(corner, corner));
+        QCOMPARE(patch(2, 2)->rect().size(), QSizeF(corner, corner));
+        QCOMPARE(patch(1, 1)->rect().size(), expected.size() - QSizeF(corner * 2, corner * 2));
+
+        QCOMPARE(patch(0, 0)->sourceRect(), QRectF(0.0, 0.0, corner, corner));
+        QCOMPARE(patch(1, 1)->sourceRect(), QRectF(corner, corner, 1.0, 1.0));
+        QCOMPARE(patch(2, 2)->sourceRect(), QRectF(corner + 1, corner + 1, corner, corner));
+    }
+
+    void testSharedTexture()
+    {
+        auto createNode = [this](const QColor &color, float blur) {
+            auto node = std::make_unique<NinePatchShadowNode>(m_window.get());
+            node->setItemRect(QRectF(0.0, 0.0, 100.0, 100.0));
+            node->setRadius(QVector4D(2.0, 2.0, 2.0, 2.0));
+            node->setBlur(blur);
+            node->setColor(color);
+            node->update();
+            return node;
+        };
+
+        auto textureOf = [](const std::unique_ptr<NinePatchShadowNode> &node) {
+            return static_cast<QSGImageNode *>(node->firstChild())->texture();
+        };
+
+        auto first = createNode(Qt::black, 4.0);
+        auto second = createNode(Qt::black, 4.0);
+        auto otherColor = createNode(Qt::red, 4.0);
+        auto otherBlur = createNode(Qt::black, 6.0);
+
+        QVERIFY(textureOf(first));
+        QCOMPARE(textureOf(second), textureOf(first));
+        QVERIFY(textureOf(otherColor) != textureOf(first));
+        QVERIFY(textureOf(otherBlur) != textureOf(first));
+    }
+
+    void testCanRender()
+    {
+        const auto radius = QVector4D(4.0, 4.0, 4.0, 4.0);
+        QVERIFY(NinePatchShadowNode::canRender(QRectF(0.0, 0.0, 100.0, 100.0), radius, 5.0, 2.0));
+        QVERIFY(!NinePatchShadowNode::canRender(QRectF(0.0, 0.0, 2.0, 100.0), radius, 5.0, 2.0));
+        QVERIFY(!NinePatchShadowNode::canRender(QRectF(0.0, 0.0, 100.0, 2.0), radius, 5.0, 2.0));
+    }
+};
+
+QTEST_MAIN(TestNinePatchShadowNode)
+
+#include "TestNinePatchShadowNode.moc"
@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include <QtTest>
+
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QSGTexture>
+
+#include <rhi/qshader.h>
+
+#include "OutlineBorderRectangleNode.h"
+#include "RectangleShadowNode.h"
+#include "ShaderMaterial.h"
+#include "ShaderNode.h"
+#include "StyledRectangleVariant.h"
+
+using namespace Qt::StringLiterals;
+
+static const auto ShaderRoot = u":/qt/qml/org/kde/union/impl/shaders/"_s;
+
+// A texture that only provides a comparison key, which is all materials look
+// at when comparing.
+class TestTexture : public QSGTexture
+{
+public:
+    TestTexture(qint64 key)
+        : m_key(key)
+    {
+    }
+
+    qint64 comparisonKey() const override
+    {
+        return m_key;
+    }
+
+    QRhiTexture *rhiTexture() const override
+    {
+        return nullptr;
+    }
+
+    QSize textureSize() const override
+    {
+        return QSize(1, 1);
+    }
+
+    bool hasAlphaChannel() const override
+    {
+        return true;
+    }
+
+    bool hasMipmaps() const override
+    {
+        return false;
+    }
+
+private:
+    qint64 m_key;
+};
+
+static QShader loadShader(const QString &name)
+{
+    QFile file(ShaderRoot + name);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QShader{};
+    }
+    return QShader::fromSerialized(file.readAll());
+}
+
+// The number of components of a vertex input of the given type.
+static int componentCount(QShaderDescription::VariableType type)
+{
+    switch (type) {
+    case QShaderDescription::Float:
+        return 1;
+    case QShaderDescription::Vec2:
+        return 2;
+    case QShaderDescription::Vec3:
+        return 3;
+    case QShaderDescription::Vec4:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+class TestShaderNode : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        // The shaders are compiled into the plugin, importing the module
+        // loads it and makes the shaders available.
+        QQmlEngine engine;
+        QQmlComponent component(&engine);
+        component.setData("import QtQml\nimport org.kde.union.impl\nQtObject {}", QUrl());
+        std::unique_ptr<QObject> object(component.create());
+        QVERIFY2(object, qPrintable(component.errorString()));
+    }
+
+    void testUniformBlock_data()
+    {
+        QTest::addColumn<QString>("shader");
+
+        QTest::addRow("rectangleshadow") << u"rectangleshadow"_s;
+        for (std::size_t variant = 0; variant < StyledRectangleVariant::Count; ++variant) {
+            if (StyledRectangleVariant::Exists[variant]) {
+                const auto name = u"styledrectangle-"_s + QString::number(variant);
+                QTest::addRow("%s", qPrintable(name)) << name;
+            }
+        }
+    }
+
+    void testUniformBlock()
+    {
+        QFETCH(QString, shader);
+
+        for (const auto &stage : {u".vert.qsb"_s, u".frag.qsb"_s}) {
+            const auto qsb = loadShader(shader + stage);
+            QVERIFY(qsb.isValid());
+
+            const auto blocks = qsb.description().uniformBlocks();
+            auto block = std::find_if(blocks.begin(), blocks.end(), [](const auto &block) {
+                return block.binding == 0;
+            });
+            QVERIFY(block != blocks.end());
+
+            // ShaderMaterialShader writes the matrix and opacity at these
+            // offsets, and the material's buffer needs to fit the block.
+            QVERIFY(block->size <= ShaderMaterial::UniformBufferSize);
+            for (const auto &member : block->members) {
+                if (member.name == "matrix") {
+                    QCOMPARE(member.offset, 0);
+                } else if (member.name == "opacity") {
+                    QCOMPARE(member.offset, int(sizeof(float) * 16));
+                } else {
+                    QFAIL(qPrintable(u"Unexpected uniform %1"_s.arg(QString::fromUtf8(member.name))));
+                }
+            }
+        }
+    }
+
+    void testShadowVertexInputs()
+    {
+        RectangleShadowNode node;
+        node.setItemRect(QRectF(0.0, 0.0, 100.0, 50.0));
+        node.setBlur(5.0);
+        node.update();
+
+        verifyVertexInputs(&node, u"rectangleshadow"_s);
+    }
+
+    void testRectangleVertexInputs()
+    {
+        OutlineBorderRectangleNode node;
+        node.m_itemRect = QRectF(0.0, 0.0, 100.0, 50.0);
+        node.m_background = nullptr;
+        node.m_border = nullptr;
+        node.m_outline = nullptr;
+        node.update();
+
+        verifyVertexInputs(&node, u"styledrectangle-0"_s);
+    }
+
+    void testExtraDataChannels()
+    {
+        ShaderNode node;
+        node.setRect(QRectF(0.0, 0.0, 10.0, 10.0));
+        node.setExtraDataChannels(2);
+        node.setExtraDataChannelData(0, QVector4D(1.0, 2.0, 3.0, 4.0));
+        const auto color = QColor::fromRgbF(1.0, 0.5, 0.0, 0.5);
+        node.setExtraDataChannelData(1, color);
+        node.update();
+
+        const auto geometry = node.geometry();
+        QVERIFY(geometry);
+
+        // Position, one UV channel and two extra data channels.
+        QCOMPARE(geometry->attributeCount(), 4);
+        QCOMPARE(geometry->attributes()[2].tupleSize, 4);
+        QCOMPARE(geometry->attributes()[3].tupleSize, 4);
+        QCOMPARE(geometry->sizeOfVertex(), int(sizeof(float) * (2 + 2 + 4 + 4)));
+        QCOMPARE(geometry->vertexCount(), 4);
+
+        // Values set for all vertices end up in every vertex, colors are
+        // premultiplied.
+        const auto vertexData = static_cast<const float *>(geometry->vertexData());
+        for (int vertex = 0; vertex < geometry->vertexCount(); ++vertex) {
+            const auto data = vertexData + vertex * 12;
+            QCOMPARE(QVector4D(data[4], data[5], data[6], data[7]), QVector4D(1.0, 2.0, 3.0, 4.0));
+            QCOMPARE(QVector4D(data[8], data[9], data[10], data[11]),
+                     QVector4D(color.redF() * color.alphaF(), color.greenF() * color.alphaF(), color.blueF() * color.alphaF(), color.alphaF()));
+        }
+    }
+
+    void testCompareTextures()
+    {
+        ShaderMaterial first(u"rectangleshadow"_s);
+        ShaderMaterial second(u"rectangleshadow"_s);
+        first.setUniformBufferSize(ShaderMaterial::UniformBufferSize);
+        second.setUniformBufferSize(ShaderMaterial::UniformBufferSize);
+
+        QCOMPARE(first.compare(&second), 0);
+
+        // Different textures from the same atlas share a comparison key.
+        TestTexture firstTexture(1);
+        TestTexture sameAtlasTexture(1);
+        TestTexture otherTexture(2);
+
+        first.setTexture(1, &firstTexture);
+        QVERIFY(first.compare(&second) != 0);
+
+        second.setTexture(1, &sameAtlasTexture);
+        QCOMPARE(first.compare(&second), 0);
+
+        second.setTexture(1, &otherTexture);
+        QVERIFY(first.compare(&second) != 0);
+        QCOMPARE(first.compare(&second), -second.compare(&first));
+    }
+
+private:
+    void verifyVertexInputs(ShaderNode *node, const QString &shader)
+    {
+        const auto geometry = node->geometry();
+        QVERIFY(geometry);
+
+        const auto qsb = loadShader(shader + u".vert.qsb"_s);
+        QVERIFY(qsb.isValid());
+
+        const auto attributes = std::span(geometry->attributes(), geometry->attributeCount());
+
+        int stride = 0;
+        for (const auto &attribute : attributes) {
+            QCOMPARE(attribute.type, QSGGeometry::FloatType);
+            stride += attribute.tupleSize * int(sizeof(float));
+        }
+        QCOMPARE(geometry->sizeOfVertex(), stride);
+
+        // Every input of the shader needs a matching attribute. Positions
+        // are passed as two components and completed by the pipeline, all
+        // other inputs need to match exactly.
+        for (const auto &input : qsb.description().inputVariables()) {
+            auto attribute = std::find_if(attributes.begin(), attributes.end(), [&input](const auto &attribute) {
+                return attribute.position == input.location;
+            });
+            QVERIFY2(attribute != attributes.end(), input.name.constData());
+
+            if (attribute->attributeType == QSGGeometry::PositionAttribute) {
+                QCOMPARE(attribute->tupleSize, 2);
+            } else {
+                QCOMPARE(attribute->tupleSize, componentCount(input.type));
+            }
+        }
+    }
+};
+
+QTEST_MAIN(TestShaderNode)
+
+#include "TestShaderNode.moc"
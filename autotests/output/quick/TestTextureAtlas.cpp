@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include <QtTest>
+
+#include <QQuickWindow>
+#include <QSGTexture>
+
+#include <rhi/qrhi.h>
+
+#include "TextureAtlas.h"
+
+static QImage createImage(int width, int height, const QColor &color = Qt::red)
+{
+    QImage image(width, height, QImage::Format_RGBA8888_Premultiplied);
+    image.fill(color);
+    return image;
+}
+
+// Returns the rect of a texture on its page, in pixels.
+static QRect pageRect(const std::unique_ptr<QSGTexture> &texture)
+{
+    const auto rect = texture->normalizedTextureSubRect();
+    return QRectF(rect.x() * TextureAtlas::PageSize,
+                  rect.y() * TextureAtlas::PageSize,
+                  rect.width() * TextureAtlas::PageSize,
+                  rect.height() * TextureAtlas::PageSize)
+        .toRect();
+}
+
+class TestTextureAtlas : public QObject
+{
+    Q_OBJECT
+
+    QQuickWindow m_window;
+
+private Q_SLOTS:
+    void testShelfPacking()
+    {
+        TextureAtlas atlas(&m_window);
+
+        std::unique_ptr<QSGTexture> first(atlas.createTexture(createImage(16, 16)));
+        std::unique_ptr<QSGTexture> second(atlas.createTexture(createImage(16, 16)));
+        QVERIFY(first);
+        QVERIFY(second);
+
+        QVERIFY(first->isAtlasTexture());
+        QCOMPARE(first->textureSize(), QSize(16, 16));
+        QCOMPARE(second->comparisonKey(), first->comparisonKey());
+
+        // Images of the same height are placed next to each other, each
+        // surrounded by padding.
+        const auto padding = TextureAtlas::Padding;
+        QCOMPARE(pageRect(first), QRect(padding, padding, 16, 16));
+        QCOMPARE(pageRect(second), QRect(16 + padding * 3, padding, 16, 16));
+
+        // A taller image does not fit the first shelf and starts a new one.
+        std::unique_ptr<QSGTexture> tall(atlas.createTexture(createImage(16, 32)));
+        QVERIFY(tall);
+        QCOMPARE(pageRect(tall), QRect(padding, 16 + padding * 3, 16, 32));
+
+        // A slightly smaller image is put on the first shelf.
+        std::unique_ptr<QSGTexture> small(atlas.createTexture(createImage(10, 10)));
+        QVERIFY(small);
+        QCOMPARE(pageRect(small), QRect(32 + padding * 5, padding, 10, 10));
+
+        // A much smaller image would waste space on either shelf.
+        std::unique_ptr<QSGTexture> tiny(atlas.createTexture(createImage(4, 4)));
+        QVERIFY(tiny);
+        QCOMPARE(pageRect(tiny), QRect(padding, 48 + padding * 5, 4, 4));
+    }
+
+    void testReleasedSpace()
+    {
+        TextureAtlas atlas(&m_window);
+
+        std::unique_ptr<QSGTexture> first(atlas.createTexture(createImage(16, 16)));
+        std::unique_ptr<QSGTexture> second(atlas.createTexture(createImage(16, 16)));
+        std::unique_ptr<QSGTexture> third(atlas.createTexture(createImage(16, 16)));
+
+        // Space of a destroyed texture is reused for an image that fits.
+        const auto released = pageRect(second);
+        second.reset();
+        std::unique_ptr<QSGTexture> reused(atlas.createTexture(createImage(16, 16)));
+        QCOMPARE(pageRect(reused), released);
+
+        // Once all textures of a page are gone, the page starts over.
+        first.reset();
+        third.reset();
+        reused.reset();
+        std::unique_ptr<QSGTexture> fresh(atlas.createTexture(createImage(32, 32)));
+        QCOMPARE(pageRect(fresh), QRect(TextureAtlas::Padding, TextureAtlas::Padding, 32, 32));
+    }
+
+    void testLimits()
+    {
+        TextureAtlas atlas(&m_window);
+
+        QVERIFY(!atlas.createTexture(QImage{}));
+        QVERIFY(!atlas.createTexture(createImage(TextureAtlas::MaxImageSize + 1, 1)));
+        QVERIFY(!atlas.createTexture(createImage(1, TextureAtlas::MaxImageSize + 1)));
+
+        // Fill the atlas with the largest images allowed. Once the maximum
+        // number of pages is full, no more textures are created.
+        std::vector<std::unique_ptr<QSGTexture>> textures;
+        QSet<qint64> pages;
+        while (auto texture = atlas.createTexture(createImage(TextureAtlas::MaxImageSize, TextureAtlas::MaxImageSize))) {
+            pages.insert(texture->comparisonKey());
+            textures.emplace_back(texture);
+        }
+
+        const auto perRow = TextureAtlas::PageSize / (TextureAtlas::MaxImageSize + TextureAtlas::Padding * 2);
+        QCOMPARE(pages.size(), qsizetype(TextureAtlas::MaxPages));
+        QCOMPARE(textures.size(), std::size_t(perRow * perRow * TextureAtlas::MaxPages));
+
+        // Smaller images still fit in the space left on the pages.
+        std::unique_ptr<QSGTexture> small(atlas.createTexture(createImage(16, 16)));
+        QVERIFY(small);
+
+        // Released space can be used again.
+        textures.pop_back();
+        std::unique_ptr<QSGTexture> reused(atlas.createTexture(createImage(TextureAtlas::MaxImageSize, TextureAtlas::MaxImageSize)));
+        QVERIFY(reused);
+    }
+
+    void testUpload()
+    {
+        QRhiNullInitParams params;
+        std::unique_ptr<QRhi> rhi(QRhi::create(QRhi::Null, &params));
+        QVERIFY(rhi);
+
+        TextureAtlas atlas(&m_window);
+
+        std::unique_ptr<QSGTexture> red(atlas.createTexture(createImage(8, 8, Qt::red)));
+        QVERIFY(red);
+
+        // Nothing is created or uploaded until the renderer commits.
+        QVERIFY(!red->rhiTexture());
+
+        auto page = commit(rhi.get(), red.get());
+        QVERIFY(red->rhiTexture());
+        QCOMPARE(page.pixelColor(pageRect(red).topLeft()), QColor(Qt::red));
+        QCOMPARE(page.pixelColor(pageRect(red).bottomRight()), QColor(Qt::red));
+        QCOMPARE(page.pixelColor(0, 0), QColor(Qt::transparent));
+
+        // Images added later are uploaded to the same page texture with the
+        // next commit, leaving earlier images alone.
+        std::unique_ptr<QSGTexture> blue(atlas.createTexture(createImage(8, 8, Qt::blue)));
+        QVERIFY(blue);
+
+        page = commit(rhi.get(), blue.get());
+        QCOMPARE(blue->rhiTexture(), red->rhiTexture());
+        QCOMPARE(page.pixelColor(pageRect(blue).topLeft()), QColor(Qt::blue));
+        QCOMPARE(page.pixelColor(pageRect(red).topLeft()), QColor(Qt::red));
+    }
+
+private:
+    // Commits the operations of texture in a frame and returns the contents
+    // of its page.
+    QImage commit(QRhi *rhi, QSGTexture *texture)
+    {
+        QRhiCommandBuffer *commandBuffer = nullptr;
+        if (rhi->beginOffscreenFrame(&commandBuffer) != QRhi::FrameOpSuccess) {
+            return QImage{};
+        }
+
+        auto resourceUpdates = rhi->nextResourceUpdateBatch();
+        texture->commitTextureOperations(rhi, resourceUpdates);
+
+        QRhiReadbackResult result;
+        resourceUpdates->readBackTexture(QRhiReadbackDescription(texture->rhiTexture()), &result);
+        commandBuffer->resourceUpdate(resourceUpdates);
+        rhi->endOffscreenFrame();
+
+        const auto image = QImage(reinterpret_cast<const uchar *>(result.data.constData()),
+                                  result.pixelSize.width(),
+                                  result.pixelSize.height(),
+                                  QImage::Format_RGBA8888_Premultiplied);
+        return image.copy();
+    }
+};
+
+QTEST_MAIN(TestTextureAtlas)
+
+#include "TestTextureAtlas.moc"
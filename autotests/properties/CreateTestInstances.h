@@ -42,6 +42,11 @@ qreal testQrealInstance()
     return 10.0;
 }
 
+Union::Length testLengthInstance()
+{
+    return Union::Length{1.5, Union::Length::Unit::Em};
+}
+
 QFont testQFontInstance()
 {
     return QFont{u"Noto Sans"_s, 12};
@@ -85,10 +90,10 @@ std::unique_ptr<SizePropertyGroup> testSizePropertyGroupInstance()
 {
     auto instance = std::make_unique<SizePropertyGroup>();
 
-    instance->setLeft(testQrealInstance());
-    instance->setRight(testQrealInstance());
-    instance->setTop(testQrealInstance());
-    instance->setBottom(testQrealInstance());
+    instance->setLeft(testLengthInstance());
+    instance->setRight(testLengthInstance());
+    instance->setTop(testLengthInstance());
+    instance->setBottom(testLengthInstance());
 
     return instance;
 }
@@ -124,7 +129,7 @@ std::unique_ptr<LinePropertyGroup> testLinePropertyGroupInstance()
 {
     auto instance = std::make_unique<LinePropertyGroup>();
 
-    instance->setSize(testQrealInstance());
+    instance->setSize(testLengthInstance());
     instance->setColor(Union::Color{});
     instance->setStyle(Union::Properties::LineStyle{});
 
@@ -135,7 +140,7 @@ std::unique_ptr<CornerPropertyGroup> testCornerPropertyGroupInstance()
 {
     auto instance = std::make_unique<CornerPropertyGroup>();
 
-    instance->setRadius(testQrealInstance());
+    instance->setRadius(testLengthInstance());
 
     return instance;
 }
@@ -155,9 +160,9 @@ std::unique_ptr<LayoutPropertyGroup> testLayoutPropertyGroupInstance()
     auto instance = std::make_unique<LayoutPropertyGroup>();
 
     instance->setAlignment(testAlignmentPropertyGroupInstance());
-    instance->setWidth(testQrealInstance());
-    instance->setHeight(testQrealInstance());
-    instance->setSpacing(testQrealInstance());
+    instance->setWidth(testLengthInstance());
+    instance->setHeight(testLengthInstance());
+    instance->setSpacing(testLengthInstance());
     instance->setPadding(testSizePropertyGroupInstance());
     instance->setInset(testSizePropertyGroupInstance());
     instance->setMargins(testSizePropertyGroupInstance());
@@ -183,8 +188,8 @@ std::unique_ptr<IconPropertyGroup> testIconPropertyGroupInstance()
     auto instance = std::make_unique<IconPropertyGroup>();
 
     instance->setAlignment(testAlignmentPropertyGroupInstance());
-    instance->setWidth(testQrealInstance());
-    instance->setHeight(testQrealInstance());
+    instance->setWidth(testLengthInstance());
+    instance->setHeight(testLengthInstance());
     instance->setName(QString{});
     instance->setSource(QUrl{});
     instance->setColor(Union::Color{});
@@ -244,8 +249,8 @@ std::unique_ptr<ShadowPropertyGroup> testShadowPropertyGroupInstance()
 
     instance->setOffset(testOffsetPropertyGroupInstance());
     instance->setColor(Union::Color{});
-    instance->setSize(testQrealInstance());
-    instance->setBlur(testQrealInstance());
+    instance->setSize(testLengthInstance());
+    instance->setBlur(testLengthInstance());
 
     return instance;
 }
@@ -254,8 +259,8 @@ std::unique_ptr<OffsetPropertyGroup> testOffsetPropertyGroupInstance()
 {
     auto instance = std::make_unique<OffsetPropertyGroup>();
 
-    instance->setHorizontal(testQrealInstance());
-    instance->setVertical(testQrealInstance());
+    instance->setHorizontal(testLengthInstance());
+    instance->setVertical(testLengthInstance());
 
     return instance;
 }
@@ -30,7 +30,7 @@ private Q_SLOTS:
         auto property = CornerPropertyGroup::empty();
 
         // An empty instance should only have values that are considered "empty".
-        QCOMPARE(property->radius().value(), emptyValue<qreal>());
+        QCOMPARE(property->radius().value(), emptyValue<Union::Length>());
     }
 
     void testHasAnyValue()
@@ -41,7 +41,7 @@ private Q_SLOTS:
         QVERIFY(!property->hasAnyValue());
 
         {
-            qreal value;
+            Union::Length value;
             property->setRadius(value);
             QVERIFY(property->hasAnyValue());
             property->setRadius(std::nullopt);
@@ -62,7 +62,7 @@ private Q_SLOTS:
 
         QVERIFY(!destination->hasAnyValue());
 
-        source->setRadius(qreal{});
+        source->setRadius(Union::Length{});
 
         QVERIFY(source->hasAnyValue());
         QVERIFY(!destination->hasAnyValue());
@@ -36,8 +36,8 @@ private Q_SLOTS:
 
         // An empty instance should only have values that are considered "empty".
         QCOMPARE(*property->alignment(), *AlignmentPropertyGroup::empty());
-        QCOMPARE(property->width().value(), emptyValue<qreal>());
-        QCOMPARE(property->height().value(), emptyValue<qreal>());
+        QCOMPARE(property->width().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->height().value(), emptyValue<Union::Length>());
         QCOMPARE(property->name().value(), emptyValue<QString>());
         QCOMPARE(property->source().value(), emptyValue<QUrl>());
         QCOMPARE(property->color().value(), emptyValue<Union::Color>());
@@ -62,14 +62,14 @@ private Q_SLOTS:
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setWidth(value);
             QVERIFY(property->hasAnyValue());
             property->setWidth(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setHeight(value);
             QVERIFY(property->hasAnyValue());
             property->setHeight(std::nullopt);
@@ -112,8 +112,8 @@ private Q_SLOTS:
         QVERIFY(!destination->hasAnyValue());
 
         source->setAlignment(testAlignmentPropertyGroupInstance());
-        source->setWidth(qreal{});
-        source->setHeight(qreal{});
+        source->setWidth(Union::Length{});
+        source->setHeight(Union::Length{});
         source->setName(QString{});
         source->setSource(QUrl{});
         source->setColor(Union::Color{});
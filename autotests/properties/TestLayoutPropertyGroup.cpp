@@ -37,9 +37,9 @@ private Q_SLOTS:
 
         // An empty instance should only have values that are considered "empty".
         QCOMPARE(*property->alignment(), *AlignmentPropertyGroup::empty());
-        QCOMPARE(property->width().value(), emptyValue<qreal>());
-        QCOMPARE(property->height().value(), emptyValue<qreal>());
-        QCOMPARE(property->spacing().value(), emptyValue<qreal>());
+        QCOMPARE(property->width().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->height().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->spacing().value(), emptyValue<Union::Length>());
         QCOMPARE(*property->padding(), *SizePropertyGroup::empty());
         QCOMPARE(*property->inset(), *SizePropertyGroup::empty());
         QCOMPARE(*property->margins(), *SizePropertyGroup::empty());
@@ -64,21 +64,21 @@ private Q_SLOTS:
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setWidth(value);
             QVERIFY(property->hasAnyValue());
             property->setWidth(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setHeight(value);
             QVERIFY(property->hasAnyValue());
             property->setHeight(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setSpacing(value);
             QVERIFY(property->hasAnyValue());
             property->setSpacing(std::nullopt);
@@ -133,9 +133,9 @@ private Q_SLOTS:
         QVERIFY(!destination->hasAnyValue());
 
         source->setAlignment(testAlignmentPropertyGroupInstance());
-        source->setWidth(qreal{});
-        source->setHeight(qreal{});
-        source->setSpacing(qreal{});
+        source->setWidth(Union::Length{});
+        source->setHeight(Union::Length{});
+        source->setSpacing(Union::Length{});
         source->setPadding(testSizePropertyGroupInstance());
         source->setInset(testSizePropertyGroupInstance());
         source->setMargins(testSizePropertyGroupInstance());
@@ -32,7 +32,7 @@ private Q_SLOTS:
         auto property = LinePropertyGroup::empty();
 
         // An empty instance should only have values that are considered "empty".
-        QCOMPARE(property->size().value(), emptyValue<qreal>());
+        QCOMPARE(property->size().value(), emptyValue<Union::Length>());
         QCOMPARE(property->color().value(), emptyValue<Union::Color>());
         QCOMPARE(property->style().value(), emptyValue<Union::Properties::LineStyle>());
     }
@@ -45,7 +45,7 @@ private Q_SLOTS:
         QVERIFY(!property->hasAnyValue());
 
         {
-            qreal value;
+            Union::Length value;
             property->setSize(value);
             QVERIFY(property->hasAnyValue());
             property->setSize(std::nullopt);
@@ -80,7 +80,7 @@ private Q_SLOTS:
 
         QVERIFY(!destination->hasAnyValue());
 
-        source->setSize(qreal{});
+        source->setSize(Union::Length{});
         source->setColor(Union::Color{});
         source->setStyle(Union::Properties::LineStyle{});
 
@@ -31,8 +31,8 @@ private Q_SLOTS:
         auto property = OffsetPropertyGroup::empty();
 
         // An empty instance should only have values that are considered "empty".
-        QCOMPARE(property->horizontal().value(), emptyValue<qreal>());
-        QCOMPARE(property->vertical().value(), emptyValue<qreal>());
+        QCOMPARE(property->horizontal().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->vertical().value(), emptyValue<Union::Length>());
     }
 
     void testHasAnyValue()
@@ -43,14 +43,14 @@ private Q_SLOTS:
         QVERIFY(!property->hasAnyValue());
 
         {
-            qreal value;
+            Union::Length value;
             property->setHorizontal(value);
             QVERIFY(property->hasAnyValue());
             property->setHorizontal(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setVertical(value);
             QVERIFY(property->hasAnyValue());
             property->setVertical(std::nullopt);
@@ -71,8 +71,8 @@ private Q_SLOTS:
 
         QVERIFY(!destination->hasAnyValue());
 
-        source->setHorizontal(qreal{});
-        source->setVertical(qreal{});
+        source->setHorizontal(Union::Length{});
+        source->setVertical(Union::Length{});
 
         QVERIFY(source->hasAnyValue());
         QVERIFY(!destination->hasAnyValue());
@@ -35,8 +35,8 @@ private Q_SLOTS:
         // An empty instance should only have values that are considered "empty".
         QCOMPARE(*property->offset(), *OffsetPropertyGroup::empty());
         QCOMPARE(property->color().value(), emptyValue<Union::Color>());
-        QCOMPARE(property->size().value(), emptyValue<qreal>());
-        QCOMPARE(property->blur().value(), emptyValue<qreal>());
+        QCOMPARE(property->size().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->blur().value(), emptyValue<Union::Length>());
     }
 
     void testHasAnyValue()
@@ -65,14 +65,14 @@ private Q_SLOTS:
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setSize(value);
             QVERIFY(property->hasAnyValue());
             property->setSize(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setBlur(value);
             QVERIFY(property->hasAnyValue());
             property->setBlur(std::nullopt);
@@ -95,8 +95,8 @@ private Q_SLOTS:
 
         source->setOffset(testOffsetPropertyGroupInstance());
         source->setColor(Union::Color{});
-        source->setSize(qreal{});
-        source->setBlur(qreal{});
+        source->setSize(Union::Length{});
+        source->setBlur(Union::Length{});
 
         QVERIFY(source->hasAnyValue());
         QVERIFY(!destination->hasAnyValue());
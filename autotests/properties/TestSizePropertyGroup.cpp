@@ -33,10 +33,10 @@ private Q_SLOTS:
         auto property = SizePropertyGroup::empty();
 
         // An empty instance should only have values that are considered "empty".
-        QCOMPARE(property->left().value(), emptyValue<qreal>());
-        QCOMPARE(property->right().value(), emptyValue<qreal>());
-        QCOMPARE(property->top().value(), emptyValue<qreal>());
-        QCOMPARE(property->bottom().value(), emptyValue<qreal>());
+        QCOMPARE(property->left().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->right().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->top().value(), emptyValue<Union::Length>());
+        QCOMPARE(property->bottom().value(), emptyValue<Union::Length>());
     }
 
     void testHasAnyValue()
@@ -47,28 +47,28 @@ private Q_SLOTS:
         QVERIFY(!property->hasAnyValue());
 
         {
-            qreal value;
+            Union::Length value;
             property->setLeft(value);
             QVERIFY(property->hasAnyValue());
             property->setLeft(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setRight(value);
             QVERIFY(property->hasAnyValue());
             property->setRight(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setTop(value);
             QVERIFY(property->hasAnyValue());
             property->setTop(std::nullopt);
             QVERIFY(!property->hasAnyValue());
         }
         {
-            qreal value;
+            Union::Length value;
             property->setBottom(value);
             QVERIFY(property->hasAnyValue());
             property->setBottom(std::nullopt);
@@ -89,10 +89,10 @@ private Q_SLOTS:
 
         QVERIFY(!destination->hasAnyValue());
 
-        source->setLeft(qreal{});
-        source->setRight(qreal{});
-        source->setTop(qreal{});
-        source->setBottom(qreal{});
+        source->setLeft(Union::Length{});
+        source->setRight(Union::Length{});
+        source->setTop(Union::Length{});
+        source->setBottom(Union::Length{});
 
         QVERIFY(source->hasAnyValue());
         QVERIFY(!destination->hasAnyValue());
@@ -542,6 +542,61 @@ QString Color::toString() const
     return u"Color("_s + data->toString() + u")"_s;
 }
 
+Color Color::folded() const
+{
+    if (!data) {
+        return *this;
+    }
+
+    auto isConstant = [](const Color &color) {
+        return color.type() == ColorData::Type::RGBA;
+    };
+
+    Color result;
+    bool constant = false;
+
+    switch (data->type) {
+    case ColorData::Type::Empty:
+    case ColorData::Type::RGBA:
+    case ColorData::Type::Custom:
+        return *this;
+    case ColorData::Type::AddOperation:
+    case ColorData::Type::SubtractOperation:
+    case ColorData::Type::MultiplyOperation: {
+        auto operation = static_cast<const ColorOperationData *>(data.get());
+        auto color = operation->color.folded();
+        auto other = operation->other.folded();
+        constant = isConstant(color) && isConstant(other);
+
+        if (data->type == ColorData::Type::AddOperation) {
+            result = Color::add(color, other);
+        } else if (data->type == ColorData::Type::SubtractOperation) {
+            result = Color::subtract(color, other);
+        } else {
+            result = Color::multiply(color, other);
+        }
+        break;
+    }
+    case ColorData::Type::SetOperation: {
+        auto operation = static_cast<const SetOperationData *>(data.get());
+        auto color = operation->color.folded();
+        constant = isConstant(color);
+        result = Color::set(color, operation->r, operation->g, operation->b, operation->a);
+        break;
+    }
+    case ColorData::Type::MixOperation: {
+        auto operation = static_cast<const MixOperationData *>(data.get());
+        auto color = operation->color.folded();
+        auto other = operation->other.folded();
+        constant = isConstant(color) && isConstant(other);
+        result = Color::mix(color, other, operation->amount);
+        break;
+    }
+    }
+
+    return constant ? result.toRgba() : result;
+}
+
 Color Color::rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
     return Color(new RgbaData(r, g, b, a));
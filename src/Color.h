@@ -135,6 +135,16 @@ public:
      */
     QColor toQColor() const;
 
+    /*!
+     * Returns this color with all operations on constant colors evaluated.
+     *
+     * Operations that only depend on RGBA colors are replaced with the
+     * resulting RGBA color, so they do not need to be evaluated every time the
+     * color is used. Operations that depend on a custom color are kept, as the
+     * value of a custom color may change at runtime.
+     */
+    Color folded() const;
+
     /*!
      * Returns a string representation of this color.
      */
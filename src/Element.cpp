@@ -27,6 +27,8 @@ public:
     Element::ColorSet colorSet;
     QStringList hints;
     QVariantMap attributes;
+    int index = -1;
+    int siblingCount = 0;
 };
 
 Element::Element(std::unique_ptr<ElementPrivate> &&dd)
@@ -199,6 +201,31 @@ void Element::setAttribute(const QString &name, const QVariant &value)
     Q_EMIT updated();
 }
 
+int Element::index() const
+{
+    return d->index;
+}
+
+int Element::siblingCount() const
+{
+    return d->siblingCount;
+}
+
+void Element::setPosition(int index, int siblingCount)
+{
+    if (d->index == index && d->siblingCount == siblingCount) {
+        return;
+    }
+
+    d->index = index;
+    d->siblingCount = siblingCount;
+
+    sendChangeEvent(Change::Position);
+
+    Q_EMIT positionChanged();
+    Q_EMIT updated();
+}
+
 QString Element::toString() const
 {
     QStringList properties;
@@ -238,6 +265,10 @@ QString Element::toString() const
         properties << u"attributes: "_s + attributes;
     }
 
+    if (d->index >= 0) {
+        properties << u"position: %1/%2"_s.arg(d->index).arg(d->siblingCount);
+    }
+
     return u"Element("_s + properties.join(u" "_s) + u")"_s;
 }
 
@@ -250,7 +281,7 @@ std::size_t Union::Element::cacheKey(std::size_t seed) const
     buffer.open(QIODevice::WriteOnly);
 
     QDataStream stream(&buffer);
-    stream << d->type << d->id << d->states << d->hints << d->attributes;
+    stream << d->type << d->id << d->states << d->hints << d->attributes << d->index << d->siblingCount;
 
     return qHash(serialized, seed);
 }
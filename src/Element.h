@@ -111,6 +111,7 @@ public:
         States = 1 << 2,
         Hints = 1 << 3,
         Attributes = 1 << 4,
+        Position = 1 << 5,
     };
     Q_DECLARE_FLAGS(Changes, Change)
     Q_FLAG(Changes)
@@ -245,6 +246,38 @@ public:
      */
     QVariant attribute(const QString &name) const;
 
+    /*!
+     * \property Union::Element::index
+     *
+     * The index of this element among its siblings.
+     *
+     * This is used for structural selectors like \c{:first-child}. It is -1
+     * if the position of the element is unknown, in which case structural
+     * selectors will not match.
+     */
+    Q_PROPERTY(int index READ index NOTIFY positionChanged)
+    int index() const;
+
+    /*!
+     * \property Union::Element::siblingCount
+     *
+     * The amount of siblings of this element, including the element itself.
+     *
+     * This is used for structural selectors like \c{:last-child}. It is 0 if
+     * the amount of siblings is unknown.
+     */
+    Q_PROPERTY(int siblingCount READ siblingCount NOTIFY positionChanged)
+    int siblingCount() const;
+
+    /*!
+     * Set the position of this element among its siblings.
+     *
+     * Both values are set together, so that a change of both sends only a
+     * single change event.
+     */
+    void setPosition(int index, int siblingCount);
+    Q_SIGNAL void positionChanged();
+
     /*!
      * Emitted whenever any of the properties of the element have changed.
      */
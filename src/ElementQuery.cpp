@@ -3,12 +3,36 @@
 
 #include "ElementQuery.h"
 
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMetaEnum>
+#include <QPromise>
+#include <QSaveFile>
+#include <QThreadPool>
+
 #include "LruCache.h"
 #include "Style.h"
 
 #include "union_query_logging.h"
 
 using namespace Union;
+using namespace Qt::StringLiterals;
+
+static std::shared_ptr<Properties::StylePropertyGroup> resolveRules(const QList<StyleRule::Ptr> &rules)
+{
+    if (rules.isEmpty()) {
+        return nullptr;
+    }
+
+    auto properties = std::make_shared<Properties::StylePropertyGroup>();
+    for (const auto &rule : rules) {
+        Properties::StylePropertyGroup::resolveProperties(rule->properties(), properties.get());
+    }
+    return properties;
+}
 
 class Union::ElementQueryPrivate
 {
@@ -19,6 +43,9 @@ public:
     std::shared_ptr<Properties::StylePropertyGroup> properties = nullptr;
 
     inline static LruCache<std::size_t, std::shared_ptr<Properties::StylePropertyGroup>, 500> s_matchesCache;
+    // Incremented whenever the cache is cleared, to discard results that were
+    // computed before that.
+    inline static quint64 s_cacheGeneration = 0;
 };
 
 ElementQuery::ElementQuery(std::shared_ptr<Style> style)
@@ -66,11 +93,7 @@ bool ElementQuery::execute()
         }
     }
 
-    d->properties = std::make_shared<Properties::StylePropertyGroup>();
-
-    for (auto style : std::as_const(d->styles)) {
-        Properties::StylePropertyGroup::resolveProperties(style->properties(), d->properties.get());
-    }
+    d->properties = resolveRules(d->styles);
 
     ElementQueryPrivate::s_matchesCache.insert(cacheKey, d->properties);
 
@@ -86,3 +109,161 @@ Properties::StylePropertyGroup *ElementQuery::properties() const
 {
     return d->properties.get();
 }
+
+void ElementQuery::clearCache()
+{
+    ElementQueryPrivate::s_matchesCache.clear();
+    ElementQueryPrivate::s_cacheGeneration++;
+}
+
+bool ElementQuery::isCached(const QList<Element::Ptr> &elements)
+{
+    return ElementQueryPrivate::s_matchesCache.contains(elementListCacheKey(elements, QHashSeed::globalSeed()));
+}
+
+QFuture<void> ElementQuery::prewarm(std::shared_ptr<Style> style, const QList<ElementList> &chains)
+{
+    auto promise = std::make_shared<QPromise<void>>();
+    auto future = promise->future();
+
+    // The style may change on the main thread while matching, so match against
+    // a copy of its rules. Rules themselves do not change once created. If the
+    // style does change, the cache gets cleared and the results are discarded.
+    const auto rules = style->activeRules();
+    const auto generation = ElementQueryPrivate::s_cacheGeneration;
+
+    QThreadPool::globalInstance()->start([promise, rules, generation, chains]() {
+        promise->start();
+
+        QList<std::pair<std::size_t, std::shared_ptr<Properties::StylePropertyGroup>>> results;
+        results.reserve(chains.size());
+        for (const auto &elements : chains) {
+            auto cacheKey = elementListCacheKey(elements, QHashSeed::globalSeed());
+            results.append(std::make_pair(cacheKey, resolveRules(Style::matches(rules, elements))));
+        }
+
+        qCDebug(UNION_QUERY) << "Prewarmed" << results.size() << "element chains";
+
+        // The match cache is not thread safe and is only used from the main
+        // thread, so insert the results from there.
+        QMetaObject::invokeMethod(QCoreApplication::instance(), [promise, results, generation]() {
+            if (generation != ElementQueryPrivate::s_cacheGeneration) {
+                qCDebug(UNION_QUERY) << "Discarding prewarmed results as the style changed";
+                promise->finish();
+                return;
+            }
+
+            for (const auto &[cacheKey, properties] : results) {
+                // Never replace results of queries executed in the meantime.
+                if (!ElementQueryPrivate::s_matchesCache.contains(cacheKey)) {
+                    ElementQueryPrivate::s_matchesCache.insert(cacheKey, properties);
+                }
+            }
+            promise->finish();
+        });
+    });
+
+    return future;
+}
+
+QList<ElementList> ElementQuery::readChains(const std::filesystem::path &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(UNION_QUERY) << "Could not open element chains file" << path.string();
+        return {};
+    }
+
+    QJsonParseError error;
+    const auto document = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError || !document.isArray()) {
+        qCWarning(UNION_QUERY) << "Could not parse element chains file" << path.string() << error.errorString();
+        return {};
+    }
+
+    const auto statesEnum = QMetaEnum::fromType<Element::States>();
+    const auto colorSetEnum = QMetaEnum::fromType<Element::ColorSet>();
+
+    QList<ElementList> result;
+    const auto chains = document.array();
+    for (const auto &chain : chains) {
+        ElementList elements;
+        const auto chainArray = chain.toArray();
+        for (const auto &entry : chainArray) {
+            const auto object = entry.toObject();
+
+            auto element = Element::create();
+            element->setType(object.value(u"type").toString());
+            element->setId(object.value(u"id").toString());
+            element->setHints(object.value(u"hints").toVariant().toStringList());
+            element->setAttributes(object.value(u"attributes").toObject().toVariantMap());
+
+            if (auto states = object.value(u"states").toString(); !states.isEmpty()) {
+                element->setStates(Element::States(statesEnum.keysToValue(states.toUtf8().constData())));
+            }
+
+            if (auto colorSet = object.value(u"colorSet").toString(); !colorSet.isEmpty()) {
+                element->setColorSet(Element::ColorSet(colorSetEnum.keyToValue(colorSet.toUtf8().constData())));
+            }
+
+            if (object.contains(u"index")) {
+                element->setPosition(object.value(u"index").toInt(), object.value(u"siblingCount").toInt());
+            }
+
+            elements.append(element);
+        }
+
+        if (!elements.isEmpty()) {
+            result.append(elements);
+        }
+    }
+
+    return result;
+}
+
+bool ElementQuery::writeChains(const std::filesystem::path &path, const QList<ElementList> &chains)
+{
+    const auto statesEnum = QMetaEnum::fromType<Element::States>();
+    const auto colorSetEnum = QMetaEnum::fromType<Element::ColorSet>();
+
+    QJsonArray chainsArray;
+    for (const auto &elements : chains) {
+        QJsonArray chainArray;
+        for (const auto &element : elements) {
+            QJsonObject object;
+            if (!element->type().isEmpty()) {
+                object.insert(u"type", element->type());
+            }
+            if (!element->id().isEmpty()) {
+                object.insert(u"id", element->id());
+            }
+            if (element->states() != Element::States{}) {
+                object.insert(u"states", QString::fromUtf8(statesEnum.valueToKeys(element->states().toInt())));
+            }
+            if (element->colorSet() != Element::ColorSet{}) {
+                object.insert(u"colorSet", QString::fromUtf8(colorSetEnum.valueToKey(int(element->colorSet()))));
+            }
+            if (!element->hints().isEmpty()) {
+                object.insert(u"hints", QJsonArray::fromStringList(element->hints()));
+            }
+            if (!element->attributes().isEmpty()) {
+                object.insert(u"attributes", QJsonObject::fromVariantMap(element->attributes()));
+            }
+            if (element->index() >= 0) {
+                object.insert(u"index", element->index());
+                object.insert(u"siblingCount", element->siblingCount());
+            }
+            chainArray.append(object);
+        }
+        chainsArray.append(chainArray);
+    }
+
+    QSaveFile file(QString::fromStdString(path.string()));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(UNION_QUERY) << "Could not open element chains file" << path.string() << "for writing";
+        return false;
+    }
+
+    file.write(QJsonDocument(chainsArray).toJson());
+    return file.commit();
+}
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <filesystem>
+
+#include <QFuture>
 #include <QList>
 #include <QString>
 
@@ -82,6 +85,60 @@ public:
      */
     Properties::StylePropertyGroup *properties() const;
 
+    /*!
+     * Clear the cache of previously matched properties.
+     *
+     * Matched properties are cached based on the list of elements. This cache
+     * needs to be cleared whenever the rules of a style change.
+     */
+    static void clearCache();
+
+    /*!
+     * Returns whether the cache contains a result for \a elements.
+     *
+     * This is mostly intended for testing and debugging.
+     */
+    static bool isCached(const QList<Element::Ptr> &elements);
+
+    /*!
+     * Resolve the properties of a list of element chains ahead of time.
+     *
+     * This matches each chain in \a chains against \a style on a worker
+     * thread and stores the result in the cache used by execute(). Executing a
+     * query for one of these chains afterwards will not need to match any
+     * rules. This is intended to be used during startup, with a list of
+     * chains that are commonly used by an application.
+     *
+     * This needs to be called from the main thread. If the cache is cleared
+     * before matching finishes, for example because the style changed, the
+     * results are discarded.
+     *
+     * Returns a future that finishes once the results have been added to the
+     * cache, or were discarded.
+     */
+    static QFuture<void> prewarm(std::shared_ptr<Union::Style> style, const QList<ElementList> &chains);
+
+    /*!
+     * Read a list of element chains from \a path.
+     *
+     * The file is expected to contain a JSON array of chains, where each chain
+     * is an array of objects describing each element, in the same order as
+     * setElements(). These files can be created with
+     * writeChains() or with the \c{--record} option of
+     * \c{union-ruleinspector}.
+     *
+     * Returns the list of element chains, or an empty list if the file could
+     * not be read.
+     */
+    static QList<ElementList> readChains(const std::filesystem::path &path);
+
+    /*!
+     * Write a list of element chains to \a path.
+     *
+     * Returns true on success, false if the file could not be written.
+     */
+    static bool writeChains(const std::filesystem::path &path, const QList<ElementList> &chains);
+
 private:
     const std::unique_ptr<ElementQueryPrivate> d;
 };
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <string_view>
+
+#include "Element.h"
+#include "PropertiesTypes.h"
+#include "StyleRule.h"
+
+namespace Union
+{
+/*!
+ * \class Union::EnumKeyword
+ * \inmodule core
+ * \ingroup core-classes
+ *
+ * \brief A keyword used to refer to an enum value.
+ *
+ * Keywords are stored case-folded and without dashes, so that for example
+ * "stack-center" can be used to refer to Alignment::StackCenter.
+ */
+template<typename T>
+struct EnumKeyword {
+    std::string_view keyword;
+    T value;
+};
+
+/*!
+ * \class Union::EnumKeywords
+ * \inmodule core
+ * \ingroup core-classes
+ *
+ * \brief A table of keywords for an enum.
+ *
+ * This is specialized for each enum that can be referred to by keyword. The
+ * table in \c keywords is sorted by keyword.
+ */
+template<typename T>
+struct EnumKeywords;
+
+namespace detail
+{
+template<typename T>
+constexpr bool keywordsSorted()
+{
+    return std::ranges::is_sorted(EnumKeywords<T>::keywords, {}, &EnumKeyword<T>::keyword);
+}
+}
+
+/* clang-format off */
+template<>
+struct EnumKeywords<Properties::ImageFlag> {
+    using enum Properties::ImageFlag;
+    static constexpr std::array<EnumKeyword<Properties::ImageFlag>, 8> keywords = {{
+        {"invertedmask", InvertedMask},
+        {"mask", Mask},
+        {"repeatboth", RepeatBoth},
+        {"repeatx", RepeatX},
+        {"repeaty", RepeatY},
+        {"stretchboth", StretchBoth},
+        {"stretchx", StretchX},
+        {"stretchy", StretchY},
+    }};
+};
+
+template<>
+struct EnumKeywords<Properties::LineStyle> {
+    using enum Properties::LineStyle;
+    static constexpr std::array<EnumKeyword<Properties::LineStyle>, 2> keywords = {{
+        {"none", None},
+        {"solid", Solid},
+    }};
+};
+
+template<>
+struct EnumKeywords<Properties::AlignmentContainer> {
+    using enum Properties::AlignmentContainer;
+    static constexpr std::array<EnumKeyword<Properties::AlignmentContainer>, 3> keywords = {{
+        {"background", Background},
+        {"content", Content},
+        {"item", Item},
+    }};
+};
+
+template<>
+struct EnumKeywords<Properties::Alignment> {
+    using enum Properties::Alignment;
+    static constexpr std::array<EnumKeyword<Properties::Alignment>, 7> keywords = {{
+        {"center", Center},
+        {"end", End},
+        {"fill", Fill},
+        {"stackcenter", StackCenter},
+        {"stackfill", StackFill},
+        {"start", Start},
+        {"unspecified", Unspecified},
+    }};
+};
+
+template<>
+struct EnumKeywords<Properties::TextWrapMode> {
+    using enum Properties::TextWrapMode;
+    static constexpr std::array<EnumKeyword<Properties::TextWrapMode>, 5> keywords = {{
+        {"manualwrap", ManualWrap},
+        {"nowrap", NoWrap},
+        {"wordwrap", WordWrap},
+        {"wrapanywhere", WrapAnywhere},
+        {"wrapatwordboundaryoranywhere", WrapAtWordBoundaryOrAnywhere},
+    }};
+};
+
+template<>
+struct EnumKeywords<Properties::TextElide> {
+    using enum Properties::TextElide;
+    static constexpr std::array<EnumKeyword<Properties::TextElide>, 4> keywords = {{
+        {"left", Left},
+        {"middle", Middle},
+        {"none", None},
+        {"right", Right},
+    }};
+};
+
+template<>
+struct EnumKeywords<Element::State> {
+    using enum Element::State;
+    static constexpr std::array<EnumKeyword<Element::State>, 8> keywords = {{
+        {"activefocus", ActiveFocus},
+        {"checked", Checked},
+        {"disabled", Disabled},
+        {"highlighted", Highlighted},
+        {"hovered", Hovered},
+        {"none", None},
+        {"pressed", Pressed},
+        {"visualfocus", VisualFocus},
+    }};
+};
+
+template<>
+struct EnumKeywords<Element::ColorSet> {
+    using enum Element::ColorSet;
+    static constexpr std::array<EnumKeyword<Element::ColorSet>, 8> keywords = {{
+        {"button", Button},
+        {"complementary", Complementary},
+        {"header", Header},
+        {"none", None},
+        {"selection", Selection},
+        {"tooltip", Tooltip},
+        {"view", View},
+        {"window", Window},
+    }};
+};
+
+template<>
+struct EnumKeywords<StyleRule::Condition> {
+    using enum StyleRule::Condition;
+    static constexpr std::array<EnumKeyword<StyleRule::Condition>, 9> keywords = {{
+        {"desktop", Desktop},
+        {"highcontrast", HighContrast},
+        {"lefttoright", LeftToRight},
+        {"mobile", Mobile},
+        {"none", None},
+        {"reducedmotion", ReducedMotion},
+        {"righttoleft", RightToLeft},
+        {"standardcontrast", StandardContrast},
+        {"standardmotion", StandardMotion},
+    }};
+};
+/* clang-format on */
+
+static_assert(detail::keywordsSorted<Properties::ImageFlag>());
+static_assert(detail::keywordsSorted<Properties::LineStyle>());
+static_assert(detail::keywordsSorted<Properties::AlignmentContainer>());
+static_assert(detail::keywordsSorted<Properties::Alignment>());
+static_assert(detail::keywordsSorted<Properties::TextWrapMode>());
+static_assert(detail::keywordsSorted<Properties::TextElide>());
+static_assert(detail::keywordsSorted<Element::State>());
+static_assert(detail::keywordsSorted<Element::ColorSet>());
+static_assert(detail::keywordsSorted<StyleRule::Condition>());
+
+/*!
+ * \relates Union::EnumKeywords
+ *
+ * Returns the enum value of type \c T that matches \a keyword.
+ *
+ * Matching ignores case and dashes. If no keyword matches exactly, the first
+ * keyword that starts with \a keyword is used, so "hover" will match
+ * Element::State::Hovered. If nothing matches, std::nullopt is returned.
+ */
+template<typename T>
+constexpr std::optional<T> enumFromKeyword(std::string_view keyword)
+{
+    std::array<char, 64> buffer{};
+    std::size_t length = 0;
+    for (auto character : keyword) {
+        if (character == '-') {
+            continue;
+        }
+
+        if (length == buffer.size()) {
+            return std::nullopt;
+        }
+
+        buffer[length++] = (character >= 'A' && character <= 'Z') ? char(character - 'A' + 'a') : character;
+    }
+
+    if (length == 0) {
+        return std::nullopt;
+    }
+
+    const auto folded = std::string_view(buffer.data(), length);
+    const auto &keywords = EnumKeywords<T>::keywords;
+
+    auto itr = std::ranges::lower_bound(keywords, folded, {}, &EnumKeyword<T>::keyword);
+    if (itr != keywords.end() && itr->keyword.starts_with(folded)) {
+        return itr->value;
+    }
+
+    return std::nullopt;
+}
+}
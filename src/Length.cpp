@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "Length.h"
+
+#include <atomic>
+
+#include <QFontInfo>
+#include <QGuiApplication>
+#include <QMutex>
+#include <QScreen>
+
+using namespace Union;
+using namespace Qt::StringLiterals;
+
+// Points are defined as 1/72 of an inch.
+static constexpr qreal PointsPerInch = 72.0;
+
+// Lengths are resolved from both the GUI and render thread, so store the
+// context values as atomics. Only the main thread updates them.
+static std::atomic<qreal> s_fontPixelSize = Length::Context{}.fontPixelSize;
+static std::atomic<qreal> s_dotsPerInch = Length::Context{}.dotsPerInch;
+static std::atomic<quint64> s_generation = 0;
+static QMutex s_contextMutex;
+
+qreal Length::toPixels() const
+{
+    switch (m_unit) {
+    case Unit::Pixels:
+        return m_value;
+    case Unit::Points:
+        return m_value * s_dotsPerInch.load(std::memory_order_relaxed) / PointsPerInch;
+    case Unit::Em:
+    case Unit::Rem:
+        return m_value * s_fontPixelSize.load(std::memory_order_relaxed);
+    }
+
+    return m_value;
+}
+
+qreal Length::toPixels(const Context &context) const
+{
+    switch (m_unit) {
+    case Unit::Pixels:
+        return m_value;
+    case Unit::Points:
+        return m_value * context.dotsPerInch / PointsPerInch;
+    case Unit::Em:
+    case Unit::Rem:
+        return m_value * context.fontPixelSize;
+    }
+
+    return m_value;
+}
+
+QString Length::toString() const
+{
+    switch (m_unit) {
+    case Unit::Pixels:
+        return QString::number(m_value) + u"px"_s;
+    case Unit::Points:
+        return QString::number(m_value) + u"pt"_s;
+    case Unit::Em:
+        return QString::number(m_value) + u"em"_s;
+    case Unit::Rem:
+        return QString::number(m_value) + u"rem"_s;
+    }
+
+    return QString::number(m_value);
+}
+
+Length::Context Length::context()
+{
+    return Context{
+        .fontPixelSize = s_fontPixelSize.load(std::memory_order_relaxed),
+        .dotsPerInch = s_dotsPerInch.load(std::memory_order_relaxed),
+    };
+}
+
+quint64 Length::contextGeneration()
+{
+    return s_generation.load(std::memory_order_acquire);
+}
+
+bool Length::setContext(const Context &context)
+{
+    QMutexLocker locker(&s_contextMutex);
+
+    if (qFuzzyCompare(s_fontPixelSize.load(), context.fontPixelSize) && qFuzzyCompare(s_dotsPerInch.load(), context.dotsPerInch)) {
+        return false;
+    }
+
+    s_fontPixelSize.store(context.fontPixelSize, std::memory_order_relaxed);
+    s_dotsPerInch.store(context.dotsPerInch, std::memory_order_relaxed);
+    s_generation.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+bool Length::updateContext()
+{
+    if (!qobject_cast<QGuiApplication *>(QCoreApplication::instance())) {
+        return false;
+    }
+
+    Context context;
+
+    // QFontInfo resolves point sizes to pixels, so this also works for fonts
+    // that only specify a point size.
+    const auto fontPixelSize = QFontInfo(QGuiApplication::font()).pixelSize();
+    if (fontPixelSize > 0) {
+        context.fontPixelSize = fontPixelSize;
+    }
+
+    if (auto screen = QGuiApplication::primaryScreen()) {
+        context.dotsPerInch = screen->logicalDotsPerInchY();
+    }
+
+    return setContext(context);
+}
+
+QDataStream &operator<<(QDataStream &stream, const Union::Length &length)
+{
+    stream << length.value() << length.unit();
+    return stream;
+}
+
+QDataStream &operator>>(QDataStream &stream, Union::Length &length)
+{
+    qreal value = 0.0;
+    Length::Unit unit = Length::Unit::Pixels;
+    stream >> value >> unit;
+    length = Length(value, unit);
+    return stream;
+}
+
+QDebug &operator<<(QDebug &stream, const Union::Length &length)
+{
+    stream << length.toString();
+    return stream;
+}
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <format>
+#include <string>
+
+#include <QDataStream>
+#include <QDebug>
+#include <QString>
+
+#include "union_export.h"
+
+namespace Union
+{
+/*!
+ * \class Union::Length
+ * \inmodule core
+ * \ingroup core-classes
+ *
+ * \brief A length with a unit that is resolved to pixels when it is used.
+ *
+ * Input plugins store lengths in the unit they were specified in, so that
+ * relative units do not need to be resolved while loading a style. Output
+ * plugins resolve the length to logical pixels using toPixels(), which uses
+ * the current resolution context. When the context changes, for example
+ * because the application font changed, the context generation is increased
+ * so output plugins know they should resolve lengths again.
+ *
+ * Length implicitly converts from qreal, where a qreal is interpreted as a
+ * length in pixels. Converting to qreal needs to be explicit, as it resolves
+ * the length using the current context.
+ */
+class UNION_EXPORT Length
+{
+public:
+    /*!
+     * \value Pixels Logical pixels.
+     * \value Points Typographic points, 1/72 of an inch.
+     * \value Em Multiple of the font size.
+     * \value Rem Multiple of the application font size.
+     */
+    enum class Unit : quint8 {
+        Pixels,
+        Points,
+        Em,
+        Rem,
+    };
+
+    /*!
+     * The values used to resolve relative units to pixels.
+     */
+    struct Context {
+        qreal fontPixelSize = 16.0;
+        qreal dotsPerInch = 96.0;
+    };
+
+    constexpr Length() = default;
+
+    /*!
+     * Constructs a length of \a pixels pixels.
+     */
+    constexpr Length(qreal pixels)
+        : m_value(pixels)
+    {
+    }
+
+    /*!
+     * Constructs a length of \a value in \a unit.
+     */
+    constexpr Length(qreal value, Unit unit)
+        : m_value(value)
+        , m_unit(unit)
+    {
+    }
+
+    /*!
+     * The magnitude of this length, in unit().
+     */
+    constexpr qreal value() const
+    {
+        return m_value;
+    }
+
+    /*!
+     * The unit of this length.
+     */
+    constexpr Unit unit() const
+    {
+        return m_unit;
+    }
+
+    /*!
+     * Returns if this length is not affected by the resolution context.
+     */
+    constexpr bool isAbsolute() const
+    {
+        return m_unit == Unit::Pixels;
+    }
+
+    /*!
+     * Returns this length in logical pixels, using the current context.
+     */
+    qreal toPixels() const;
+
+    /*!
+     * Returns this length in logical pixels, using \a context.
+     */
+    qreal toPixels(const Context &context) const;
+
+    /*!
+     * Returns this length in logical pixels, using the current context.
+     *
+     * \sa toPixels()
+     */
+    explicit operator qreal() const
+    {
+        return toPixels();
+    }
+
+    /*!
+     * Returns a string representation of this length, like "1.5em".
+     */
+    QString toString() const;
+
+    /*!
+     * Lengths compare by value and unit, without resolving them.
+     *
+     * Comparing with a qreal compares with a length of that many pixels, so
+     * 1em is never equal to 16.0 regardless of the context.
+     */
+    friend bool operator==(const Length &left, const Length &right) = default;
+
+    /*!
+     * Returns the current resolution context.
+     */
+    static Context context();
+
+    /*!
+     * Returns the generation of the current resolution context.
+     *
+     * This is increased every time the context changes, so it can be used to
+     * cache values resolved using the context.
+     */
+    static quint64 contextGeneration();
+
+    /*!
+     * Set the resolution context to \a context.
+     *
+     * Returns true if the context changed.
+     */
+    static bool setContext(const Context &context);
+
+    /*!
+     * Update the resolution context from the application font and screen.
+     *
+     * This needs to be called from the main thread. Returns true if the
+     * context changed.
+     */
+    static bool updateContext();
+
+private:
+    qreal m_value = 0.0;
+    Unit m_unit = Unit::Pixels;
+};
+}
+
+UNION_EXPORT QDataStream &operator<<(QDataStream &stream, const Union::Length &length);
+UNION_EXPORT QDataStream &operator>>(QDataStream &stream, Union::Length &length);
+
+UNION_EXPORT QDebug &operator<<(QDebug &stream, const Union::Length &length);
+
+Q_DECLARE_METATYPE(Union::Length)
+
+/*!
+ * \relates Union::Length
+ *
+ * Specialization of std::formatter to support formatting a length as string.
+ */
+template<>
+struct std::formatter<Union::Length, char> : public std::formatter<std::string, char> {
+    template<class FormatContext>
+    FormatContext::iterator format(const Union::Length &value, FormatContext &context) const
+    {
+        auto string = value.toString().toStdString();
+        return std::formatter<std::string, char>::format(string, context);
+    }
+};
@@ -28,8 +28,11 @@ namespace Union
  * Values are expected to be copyable types. Do not use this to store raw
  * pointers, instead use some form of managed pointer when storing
  * heap-allocated data.
+ *
+ * Keys are hashed using \p Hash, keys with the same hash are told apart by
+ * comparing them.
  */
-template<typename Key, typename Value, std::size_t MaxSize = 100>
+template<typename Key, typename Value, std::size_t MaxSize = 100, typename Hash = std::hash<Key>>
 class LruCache
 {
 public:
@@ -106,7 +109,7 @@ private:
     std::list<Key> m_usageTracker;
     // Hash used to keep track of values. The iterator is used to keep track of
     // the position of the key in m_usageTracker.
-    std::unordered_map<Key, std::pair<Value, typename std::list<Key>::iterator>> m_values;
+    std::unordered_map<Key, std::pair<Value, typename std::list<Key>::iterator>, Hash> m_values;
 };
 
 /*!
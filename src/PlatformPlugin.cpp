@@ -3,7 +3,13 @@
 
 #include "PlatformPlugin.h"
 
+#include <QGuiApplication>
 #include <QIcon>
+#include <QStyleHints>
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 10, 0)
+#include <QAccessibilityHints>
+#endif
 
 using namespace Union;
 using namespace Qt::StringLiterals;
@@ -11,6 +17,16 @@ using namespace Qt::StringLiterals;
 PlatformPlugin::PlatformPlugin(QObject *parent)
     : Plugin(parent)
 {
+    connect(this, &PlatformPlugin::animationSpeedMultiplierChanged, this, &PlatformPlugin::conditionsChanged);
+    if (qGuiApp) {
+        connect(qGuiApp, &QGuiApplication::layoutDirectionChanged, this, &PlatformPlugin::conditionsChanged);
+#if QT_VERSION >= QT_VERSION_CHECK(6, 10, 0)
+        connect(QGuiApplication::styleHints()->accessibility(),
+                &QAccessibilityHints::contrastPreferenceChanged,
+                this,
+                &PlatformPlugin::conditionsChanged);
+#endif
+    }
 }
 
 QString PlatformPlugin::defaultInputPlugin()
@@ -32,3 +48,34 @@ qreal PlatformPlugin::animationSpeedMultiplier()
 {
     return 1.0;
 }
+
+StyleRule::Conditions PlatformPlugin::conditions()
+{
+    using enum StyleRule::Condition;
+
+    StyleRule::Conditions result;
+
+    result |= qEnvironmentVariableIsSet("QT_QUICK_CONTROLS_MOBILE") ? Mobile : Desktop;
+
+    if (qGuiApp && qGuiApp->layoutDirection() == Qt::RightToLeft) {
+        result |= RightToLeft;
+    } else {
+        result |= LeftToRight;
+    }
+
+    result |= qFuzzyIsNull(animationSpeedMultiplier()) ? ReducedMotion : StandardMotion;
+
+    // The contrast preference is only exposed by Qt since 6.10, before that
+    // there is no portable way to detect it.
+#if QT_VERSION >= QT_VERSION_CHECK(6, 10, 0)
+    if (qGuiApp && QGuiApplication::styleHints()->accessibility()->contrastPreference() == Qt::ContrastPreference::HighContrast) {
+        result |= HighContrast;
+    } else {
+        result |= StandardContrast;
+    }
+#else
+    result |= StandardContrast;
+#endif
+
+    return result;
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "PluginRegistry.h"
+#include "StyleRule.h"
 
 #include "union_export.h"
 
@@ -69,6 +70,24 @@ public:
      * Emitted whenever animationSpeedMultiplier changes.
      */
     Q_SIGNAL void animationSpeedMultiplierChanged();
+    /*!
+     * Returns the conditions that are active on this platform.
+     *
+     * These are used to select which style rules apply, see
+     * StyleRule::conditions(). The result should contain exactly one condition
+     * of each pair, like either Desktop or Mobile.
+     *
+     * By default this will return Mobile if \c QT_QUICK_CONTROLS_MOBILE is set,
+     * use the application's layout direction and return ReducedMotion if
+     * animationSpeedMultiplier() is 0. HighContrast is returned if the
+     * platform reports a preference for high contrast, which requires Qt 6.10
+     * or later.
+     */
+    virtual StyleRule::Conditions conditions();
+    /*!
+     * Emitted whenever conditions changes.
+     */
+    Q_SIGNAL void conditionsChanged();
 };
 
 }
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "PluginRegistry.h"
+
+#include <QFile>
+#include <QGlobalStatic>
+#include <QMutex>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include "QDataStreamExtras.h"
+
+using namespace Union;
+
+namespace fs = std::filesystem;
+
+// Magic value to indicate the file is a proper plugin index file.
+// Matches this ascii:                   #  U  N  I  O  N  P  I
+static constexpr quint64 IndexMagic = 0x23'55'4E'49'4F'4E'50'49;
+// Version of the index file. Increase this whenever the format changes.
+static constexpr uint32_t IndexVersion = 1;
+
+struct IndexEntry {
+    fs::file_time_type modificationTime;
+    QList<fs::path> paths;
+    QList<QJsonObject> metaData;
+};
+
+class PluginIndex
+{
+public:
+    PluginIndex()
+    {
+        if (qEnvironmentVariableIsSet("UNION_DISABLE_STYLE_CACHE")) {
+            enabled = false;
+            return;
+        }
+
+        indexPath = fs::path(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation).toStdString()) / "union" / "plugins.index";
+        read();
+    }
+
+    QList<detail::PluginMetaData> metaData(const QList<fs::path> &directories)
+    {
+        QMutexLocker locker(&mutex);
+
+        QList<detail::PluginMetaData> result;
+        bool changed = false;
+
+        for (const auto &directory : directories) {
+            std::error_code error;
+            const auto modificationTime = fs::last_write_time(directory, error);
+            if (error) {
+                continue;
+            }
+
+            const auto key = QString::fromStdString(directory.string());
+
+            auto itr = entries.constFind(key);
+            if (itr == entries.constEnd() || itr->modificationTime != modificationTime) {
+                qCDebug(UNION_GENERAL) << "Scanning plugin directory" << directory.string();
+                itr = entries.insert(key, scan(directory, modificationTime));
+                changed = true;
+            }
+
+            for (qsizetype i = 0; i < itr->paths.size(); ++i) {
+                result.append(detail::PluginMetaData{.path = itr->paths.at(i), .metaData = itr->metaData.at(i)});
+            }
+        }
+
+        // Only write the index once all directories have been scanned.
+        if (changed) {
+            write();
+        }
+
+        return result;
+    }
+
+private:
+    IndexEntry scan(const fs::path &directory, fs::file_time_type modificationTime)
+    {
+        IndexEntry entry;
+        entry.modificationTime = modificationTime;
+
+        for (const auto &file : fs::directory_iterator(directory)) {
+            QPluginLoader loader(QString::fromStdString(file.path()));
+            entry.paths.append(file.path());
+            entry.metaData.append(loader.metaData().value(u"MetaData").toObject());
+        }
+
+        return entry;
+    }
+
+    void read()
+    {
+        QFile file(indexPath);
+        if (!file.open(QIODevice::ReadOnly)) {
+            return;
+        }
+
+        QDataStream reader(&file);
+        reader.setVersion(QDataStream::Qt_6_9);
+
+        quint64 magic = 0;
+        uint32_t version = 0;
+        reader >> magic >> version;
+        if (magic != IndexMagic || version != IndexVersion) {
+            return;
+        }
+
+        qsizetype count = 0;
+        reader >> count;
+
+        QHash<QString, IndexEntry> result;
+        for (qsizetype i = 0; i < count; ++i) {
+            QString directory;
+            IndexEntry entry;
+            reader >> directory >> entry.modificationTime >> entry.paths >> entry.metaData;
+            if (entry.paths.size() != entry.metaData.size()) {
+                return;
+            }
+            result.insert(directory, entry);
+        }
+
+        if (reader.status() != QDataStream::Status::Ok) {
+            qCDebug(UNION_GENERAL) << "Ignoring plugin index" << indexPath.string() << "reading failed";
+            return;
+        }
+
+        entries = result;
+    }
+
+    void write()
+    {
+        if (!enabled) {
+            return;
+        }
+
+        std::error_code error;
+        fs::create_directories(indexPath.parent_path(), error);
+
+        QSaveFile file(QString::fromStdString(indexPath));
+        if (!file.open(QIODevice::WriteOnly)) {
+            qCWarning(UNION_GENERAL) << "Could not open plugin index" << qPrintable(file.fileName()) << "for writing";
+            return;
+        }
+
+        QDataStream writer(&file);
+        writer.setVersion(QDataStream::Qt_6_9);
+
+        writer << IndexMagic << IndexVersion;
+        writer << entries.size();
+        for (auto [directory, entry] : entries.asKeyValueRange()) {
+            writer << directory << entry.modificationTime << entry.paths << entry.metaData;
+        }
+
+        if (!file.commit()) {
+            qCWarning(UNION_GENERAL) << "Could not commit plugin index" << qPrintable(file.fileName());
+        }
+    }
+
+    bool enabled = true;
+    fs::path indexPath;
+    QHash<QString, IndexEntry> entries;
+    QMutex mutex;
+};
+
+Q_GLOBAL_STATIC(PluginIndex, s_pluginIndex)
+
+QList<detail::PluginMetaData> detail::pluginMetaData(const QList<std::filesystem::path> &directories)
+{
+    return s_pluginIndex->metaData(directories);
+}
+
+#include "moc_PluginRegistry.cpp"
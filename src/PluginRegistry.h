@@ -53,6 +53,24 @@ private:
     QJsonObject m_metaData;
 };
 
+namespace detail
+{
+struct PluginMetaData {
+    std::filesystem::path path;
+    QJsonObject metaData;
+};
+
+/*
+ * Returns the metadata of all plugins in a list of directories.
+ *
+ * Reading plugin metadata requires opening each plugin file, so this uses an
+ * index that is cached on disk. The index is keyed by the modification time
+ * of each directory, when that changes the directory is scanned again. The
+ * index is written once after all directories have been checked.
+ */
+UNION_EXPORT QList<PluginMetaData> pluginMetaData(const QList<std::filesystem::path> &directories);
+}
+
 /*!
  * \class Union::PluginRegistry
  * \inmodule core
@@ -120,6 +138,8 @@ public:
 private:
     void findAllPlugins()
     {
+        QList<std::filesystem::path> paths;
+
         const auto pluginDirs = QCoreApplication::libraryPaths();
         for (const auto &dir : pluginDirs) {
             const auto path = std::filesystem::path(dir.toStdString()) / "union";
@@ -128,15 +148,16 @@ private:
                 continue;
             }
 
-            for (const auto &entry : std::filesystem::directory_iterator(path)) {
-                QPluginLoader loader(QString::fromStdString(entry.path()));
-                const auto metaData = loader.metaData().value(u"MetaData").toObject();
-                const auto type = metaData.value(u"union-plugintype").toString();
-                const auto name = metaData.value(u"union-pluginname").toString();
+            paths.append(path);
+        }
+
+        const auto entries = detail::pluginMetaData(paths);
+        for (const auto &entry : entries) {
+            const auto type = entry.metaData.value(u"union-plugintype").toString();
+            const auto name = entry.metaData.value(u"union-pluginname").toString();
 
-                if (type == m_type && metaDataMatch(metaData, m_matchMetaData)) {
-                    m_plugins.append(PluginInfo{.path = entry, .name = name, .metaData = metaData});
-                }
+            if (type == m_type && metaDataMatch(entry.metaData, m_matchMetaData)) {
+                m_plugins.append(PluginInfo{.path = entry.path, .name = name, .metaData = entry.metaData});
             }
         }
     }
@@ -166,6 +187,12 @@ private:
             return nullptr;
         }
 
+        // Plugins may be loaded from a worker thread, make sure they always
+        // live on the main thread.
+        if (object->thread() != QCoreApplication::instance()->thread()) {
+            object->moveToThread(QCoreApplication::instance()->thread());
+        }
+
         auto plugin = static_cast<T *>(loader.instance());
         plugin->m_path = path;
         plugin->m_name = name;
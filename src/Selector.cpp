@@ -3,11 +3,13 @@
 
 #include "Selector.h"
 
+#include <algorithm>
 #include <ranges>
 
 #include <QMetaEnum>
 
 #include "Element.h"
+#include "Length.h"
 
 #include "union_export.h"
 
@@ -30,6 +32,19 @@ void appendFromStream<SelectorType::Empty>([[maybe_unused]] QDataStream &stream,
 
 SelectorPrivateConcept::~SelectorPrivateConcept() = default;
 
+// Whitespace as defined by CSS, which is used to separate words in attribute
+// values.
+static bool isCssWhitespace(QChar character)
+{
+    return character == u' ' || character == u'\t' || character == u'\n' || character == u'\r' || character == u'\f';
+}
+
+SelectorPreparedData<std::pair<QString, QString>>::SelectorPreparedData(const std::pair<QString, QString> &data)
+    : operand(data.second.toCaseFolded())
+    , operandHasWhitespace(std::ranges::any_of(data.second, isCssWhitespace))
+{
+}
+
 /***** SelectorType::Type *****/
 template<>
 UNION_EXPORT int SelectorPrivateModel<SelectorType::Type, QString>::weight() const
@@ -205,6 +220,14 @@ UNION_EXPORT bool SelectorPrivateModel<SelectorType::AttributeEquals, std::pair<
         return false;
     }
 
+    // Lengths are stored with their unit and only resolved here, so the
+    // result follows changes to the resolution context.
+    if (const auto length = get_if<Length>(&data.second)) {
+        bool ok = false;
+        const auto pixels = value.toReal(&ok);
+        return ok && qFuzzyCompare(pixels, length->toPixels());
+    }
+
     if (value.typeId() == QMetaType::QString) {
         return value.toString().compare(data.second.toString(), Qt::CaseInsensitive) == 0;
     } else {
@@ -215,6 +238,9 @@ UNION_EXPORT bool SelectorPrivateModel<SelectorType::AttributeEquals, std::pair<
 template<>
 UNION_EXPORT QString SelectorPrivateModel<SelectorType::AttributeEquals, std::pair<QString, QVariant>>::toString() const
 {
+    if (const auto length = get_if<Length>(&data.second)) {
+        return u"AttributeEquals(key=%1, value=%2)"_s.arg(data.first, length->toString());
+    }
     return u"AttributeEquals(key=%1, value=%2)"_s.arg(data.first, data.second.toString());
 }
 
@@ -226,6 +252,21 @@ void appendFromStream<SelectorType::AttributeEquals>(QDataStream &stream, Union:
     destination.append(Selector::create<SelectorType::AttributeEquals>(data));
 }
 
+// Calls function with the case-folded value of attribute name of element as
+// string and returns its result. Operands are folded when the selector is
+// created, so the result can be compared case-sensitively against those.
+template<typename Function>
+static bool matchFoldedAttribute(Element *element, const QString &name, Function &&function)
+{
+    const auto value = element->attribute(name);
+    if (!value.isValid()) {
+        return false;
+    }
+
+    const auto folded = value.toString().toCaseFolded();
+    return function(QStringView(folded));
+}
+
 /***** SelectorType::AttributeSubstringMatch *****/
 template<>
 UNION_EXPORT int SelectorPrivateModel<SelectorType::AttributeSubstringMatch, std::pair<QString, QString>>::weight() const
@@ -236,14 +277,13 @@ UNION_EXPORT int SelectorPrivateModel<SelectorType::AttributeSubstringMatch, std
 template<>
 UNION_EXPORT bool SelectorPrivateModel<SelectorType::AttributeSubstringMatch, std::pair<QString, QString>>::matches(Element *element) const
 {
-    if (data.first.isEmpty() || data.second.isNull()) {
+    if (data.first.isEmpty() || prepared.operand.isEmpty()) {
         return false;
     }
 
-    if (element->hasAttribute(data.first)) {
-        return element->attribute(data.first).toString().contains(data.second, Qt::CaseSensitivity::CaseInsensitive);
-    }
-    return false;
+    return matchFoldedAttribute(element, data.first, [this](QStringView value) {
+        return value.contains(prepared.operand);
+    });
 }
 
 template<>
@@ -260,6 +300,270 @@ void appendFromStream<SelectorType::AttributeSubstringMatch>(QDataStream &stream
     destination.append(Selector::create<SelectorType::AttributeSubstringMatch>(data));
 }
 
+/***** SelectorType::AttributeIncludes *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::AttributeIncludes, std::pair<QString, QString>>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::AttributeIncludes, std::pair<QString, QString>>::matches(Element *element) const
+{
+    if (data.first.isEmpty() || prepared.operand.isEmpty() || prepared.operandHasWhitespace) {
+        return false;
+    }
+
+    return matchFoldedAttribute(element, data.first, [this](QStringView value) {
+        qsizetype start = 0;
+        while (start < value.size()) {
+            while (start < value.size() && isCssWhitespace(value.at(start))) {
+                start++;
+            }
+
+            auto end = start;
+            while (end < value.size() && !isCssWhitespace(value.at(end))) {
+                end++;
+            }
+
+            if (end > start && value.sliced(start, end - start) == prepared.operand) {
+                return true;
+            }
+
+            start = end;
+        }
+        return false;
+    });
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::AttributeIncludes, std::pair<QString, QString>>::toString() const
+{
+    return u"AttributeIncludes(key=%1, value=%2)"_s.arg(data.first, data.second);
+}
+
+template<>
+void appendFromStream<SelectorType::AttributeIncludes>(QDataStream &stream, Union::SelectorList &destination)
+{
+    std::pair<QString, QString> data;
+    stream >> data;
+    destination.append(Selector::create<SelectorType::AttributeIncludes>(data));
+}
+
+/***** SelectorType::AttributePrefixMatch *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::AttributePrefixMatch, std::pair<QString, QString>>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::AttributePrefixMatch, std::pair<QString, QString>>::matches(Element *element) const
+{
+    if (data.first.isEmpty() || prepared.operand.isEmpty()) {
+        return false;
+    }
+
+    return matchFoldedAttribute(element, data.first, [this](QStringView value) {
+        return value.startsWith(prepared.operand);
+    });
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::AttributePrefixMatch, std::pair<QString, QString>>::toString() const
+{
+    return u"AttributePrefixMatch(key=%1, value=%2)"_s.arg(data.first, data.second);
+}
+
+template<>
+void appendFromStream<SelectorType::AttributePrefixMatch>(QDataStream &stream, Union::SelectorList &destination)
+{
+    std::pair<QString, QString> data;
+    stream >> data;
+    destination.append(Selector::create<SelectorType::AttributePrefixMatch>(data));
+}
+
+/***** SelectorType::AttributeSuffixMatch *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::AttributeSuffixMatch, std::pair<QString, QString>>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::AttributeSuffixMatch, std::pair<QString, QString>>::matches(Element *element) const
+{
+    if (data.first.isEmpty() || prepared.operand.isEmpty()) {
+        return false;
+    }
+
+    return matchFoldedAttribute(element, data.first, [this](QStringView value) {
+        return value.endsWith(prepared.operand);
+    });
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::AttributeSuffixMatch, std::pair<QString, QString>>::toString() const
+{
+    return u"AttributeSuffixMatch(key=%1, value=%2)"_s.arg(data.first, data.second);
+}
+
+template<>
+void appendFromStream<SelectorType::AttributeSuffixMatch>(QDataStream &stream, Union::SelectorList &destination)
+{
+    std::pair<QString, QString> data;
+    stream >> data;
+    destination.append(Selector::create<SelectorType::AttributeSuffixMatch>(data));
+}
+
+/***** SelectorType::AttributeDashMatch *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::AttributeDashMatch, std::pair<QString, QString>>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::AttributeDashMatch, std::pair<QString, QString>>::matches(Element *element) const
+{
+    if (data.first.isEmpty() || prepared.operand.isEmpty()) {
+        return false;
+    }
+
+    return matchFoldedAttribute(element, data.first, [this](QStringView value) {
+        if (!value.startsWith(prepared.operand)) {
+            return false;
+        }
+        return value.size() == prepared.operand.size() || value.at(prepared.operand.size()) == u'-';
+    });
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::AttributeDashMatch, std::pair<QString, QString>>::toString() const
+{
+    return u"AttributeDashMatch(key=%1, value=%2)"_s.arg(data.first, data.second);
+}
+
+template<>
+void appendFromStream<SelectorType::AttributeDashMatch>(QDataStream &stream, Union::SelectorList &destination)
+{
+    std::pair<QString, QString> data;
+    stream >> data;
+    destination.append(Selector::create<SelectorType::AttributeDashMatch>(data));
+}
+
+// Returns whether the one-based position matches an+b for any n >= 0.
+static bool matchesNth(int position, const std::pair<int, int> &nth)
+{
+    const auto [a, b] = nth;
+    if (a == 0) {
+        return position == b;
+    }
+
+    const auto difference = position - b;
+    return difference / a >= 0 && difference % a == 0;
+}
+
+/***** SelectorType::FirstChild *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::FirstChild, Empty>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::FirstChild, Empty>::matches(Element *element) const
+{
+    return element->index() == 0;
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::FirstChild, Empty>::toString() const
+{
+    return u"FirstChild"_s;
+}
+
+/***** SelectorType::LastChild *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::LastChild, Empty>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::LastChild, Empty>::matches(Element *element) const
+{
+    return element->index() >= 0 && element->index() == element->siblingCount() - 1;
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::LastChild, Empty>::toString() const
+{
+    return u"LastChild"_s;
+}
+
+/***** SelectorType::NthChild *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::NthChild, std::pair<int, int>>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::NthChild, std::pair<int, int>>::matches(Element *element) const
+{
+    if (element->index() < 0) {
+        return false;
+    }
+
+    return matchesNth(element->index() + 1, data);
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::NthChild, std::pair<int, int>>::toString() const
+{
+    return u"NthChild(%1n+%2)"_s.arg(data.first).arg(data.second);
+}
+
+template<>
+void appendFromStream<SelectorType::NthChild>(QDataStream &stream, Union::SelectorList &destination)
+{
+    std::pair<int, int> data;
+    stream >> data;
+    destination.append(Selector::create<SelectorType::NthChild>(data));
+}
+
+/***** SelectorType::NthLastChild *****/
+template<>
+UNION_EXPORT int SelectorPrivateModel<SelectorType::NthLastChild, std::pair<int, int>>::weight() const
+{
+    return 10;
+}
+
+template<>
+UNION_EXPORT bool SelectorPrivateModel<SelectorType::NthLastChild, std::pair<int, int>>::matches(Element *element) const
+{
+    if (element->index() < 0 || element->index() >= element->siblingCount()) {
+        return false;
+    }
+
+    return matchesNth(element->siblingCount() - element->index(), data);
+}
+
+template<>
+UNION_EXPORT QString SelectorPrivateModel<SelectorType::NthLastChild, std::pair<int, int>>::toString() const
+{
+    return u"NthLastChild(%1n+%2)"_s.arg(data.first).arg(data.second);
+}
+
+template<>
+void appendFromStream<SelectorType::NthLastChild>(QDataStream &stream, Union::SelectorList &destination)
+{
+    std::pair<int, int> data;
+    stream >> data;
+    destination.append(Selector::create<SelectorType::NthLastChild>(data));
+}
+
 /***** SelectorType::AnyElement *****/
 template<>
 UNION_EXPORT int SelectorPrivateModel<SelectorType::AnyElement, Empty>::weight() const
@@ -379,6 +683,19 @@ bool Selector::isCombinator() const
     return d->isCombinator();
 }
 
+bool Selector::isStructural() const
+{
+    switch (type()) {
+    case SelectorType::FirstChild:
+    case SelectorType::LastChild:
+    case SelectorType::NthChild:
+    case SelectorType::NthLastChild:
+        return true;
+    default:
+        return false;
+    }
+}
+
 Selector::Selector(const std::shared_ptr<const detail::SelectorPrivateConcept> &_d)
     : d(_d)
 {
@@ -493,6 +810,14 @@ QDataStream &operator>>(QDataStream &stream, Union::SelectorList &selectors)
                        SelectorType::AttributeExists,
                        SelectorType::AttributeEquals,
                        SelectorType::AttributeSubstringMatch,
+                       SelectorType::AttributeIncludes,
+                       SelectorType::AttributePrefixMatch,
+                       SelectorType::AttributeSuffixMatch,
+                       SelectorType::AttributeDashMatch,
+                       SelectorType::FirstChild,
+                       SelectorType::LastChild,
+                       SelectorType::NthChild,
+                       SelectorType::NthLastChild,
                        SelectorType::AnyElement,
                        SelectorType::ChildCombinator,
                        SelectorType::DescendantCombinator>(selectorType, stream, selectors);
@@ -61,6 +61,37 @@ class SelectorList;
  * \value DescendantCombinator
  *      A combinator that will match if the element is a descendant at any level
  *      of the parent.
+ * \value AttributeIncludes
+ *      A selector matching on an attribute in the
+ *      \l{Union::Element::attributes}{attributes} property. Checks if the
+ *      provided value is one of the whitespace-separated words of the
+ *      property's value.
+ * \value AttributePrefixMatch
+ *      A selector matching on an attribute in the
+ *      \l{Union::Element::attributes}{attributes} property. Checks if the
+ *      property's value starts with the provided value.
+ * \value AttributeSuffixMatch
+ *      A selector matching on an attribute in the
+ *      \l{Union::Element::attributes}{attributes} property. Checks if the
+ *      property's value ends with the provided value.
+ * \value AttributeDashMatch
+ *      A selector matching on an attribute in the
+ *      \l{Union::Element::attributes}{attributes} property. Checks if the
+ *      property's value is the provided value or starts with the provided
+ *      value followed by a dash.
+ * \value FirstChild
+ *      A selector matching on the \l{Union::Element::index}{index} property.
+ *      Checks if the element is the first of its siblings.
+ * \value LastChild
+ *      A selector matching on the \l{Union::Element::index}{index} and
+ *      \l{Union::Element::siblingCount}{siblingCount} properties. Checks if the
+ *      element is the last of its siblings.
+ * \value NthChild
+ *      A selector matching on the \l{Union::Element::index}{index} property.
+ *      The data is a pair of \c{a} and \c{b}, the selector checks if the
+ *      one-based position of the element equals \c{an+b} for any \c{n >= 0}.
+ * \value NthLastChild
+ *      The same as NthChild, but counting from the last sibling.
  */
 enum class SelectorType {
     Empty,
@@ -74,6 +105,14 @@ enum class SelectorType {
     AnyElement,
     ChildCombinator,
     DescendantCombinator,
+    AttributeIncludes,
+    AttributePrefixMatch,
+    AttributeSuffixMatch,
+    AttributeDashMatch,
+    FirstChild,
+    LastChild,
+    NthChild,
+    NthLastChild,
 };
 
 namespace detail
@@ -83,6 +122,28 @@ namespace detail
 struct Empty {
 };
 
+// Data that is derived from the data of a selector once, when the selector is
+// created, so matching does not need to compute it for every element. Most
+// selectors do not need any.
+template<typename T>
+struct SelectorPreparedData {
+    SelectorPreparedData([[maybe_unused]] const T &data)
+    {
+    }
+};
+
+// Attribute string matches are case-insensitive. The operand is case-folded
+// here so matching only needs to fold the attribute value and can then
+// compare case-sensitively.
+template<>
+struct UNION_EXPORT SelectorPreparedData<std::pair<QString, QString>> {
+    SelectorPreparedData(const std::pair<QString, QString> &data);
+
+    QString operand;
+    // An operand containing whitespace can never be a single word of a value.
+    bool operandHasWhitespace = false;
+};
+
 // Clang-format insists on moving the template declarations to their own line which makes this utterly unreadable.
 /* clang-format off */
 
@@ -93,6 +154,8 @@ template <SelectorType type, typename T> constexpr bool ArgumentTypesMatch = fal
 template <> inline constexpr bool ArgumentTypesMatch<SelectorType::AnyElement, Empty> = true;
 template <> inline constexpr bool ArgumentTypesMatch<SelectorType::ChildCombinator, Empty> = true;
 template <> inline constexpr bool ArgumentTypesMatch<SelectorType::DescendantCombinator, Empty> = true;
+template <> inline constexpr bool ArgumentTypesMatch<SelectorType::FirstChild, Empty> = true;
+template <> inline constexpr bool ArgumentTypesMatch<SelectorType::LastChild, Empty> = true;
 template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::Type, T> = std::is_same_v<T, QString>;
 template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::Id, T> = std::is_same_v<T, QString>;
 template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::State, T> = std::is_same_v<T, Element::State>;
@@ -100,6 +163,12 @@ template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::Hint, T> =
 template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::AttributeExists, T> = std::is_same_v<T, QString>;
 template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::AttributeEquals, T> = std::is_same_v<T, std::pair<QString, QVariant>>;
 template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::AttributeSubstringMatch, T> = std::is_same_v<T, std::pair<QString, QString>>;
+template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::AttributeIncludes, T> = std::is_same_v<T, std::pair<QString, QString>>;
+template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::AttributePrefixMatch, T> = std::is_same_v<T, std::pair<QString, QString>>;
+template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::AttributeSuffixMatch, T> = std::is_same_v<T, std::pair<QString, QString>>;
+template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::AttributeDashMatch, T> = std::is_same_v<T, std::pair<QString, QString>>;
+template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::NthChild, T> = std::is_same_v<T, std::pair<int, int>>;
+template <typename T> constexpr bool ArgumentTypesMatch<SelectorType::NthLastChild, T> = std::is_same_v<T, std::pair<int, int>>;
 /* clang-format on */
 
 // Partial type-erasure implementation for Selector.
@@ -123,6 +192,7 @@ template<SelectorType _type, typename T>
 struct SelectorPrivateModel : public SelectorPrivateConcept {
     SelectorPrivateModel(const T &_data)
         : data(_data)
+        , prepared(data)
     {
     }
 
@@ -148,6 +218,7 @@ struct SelectorPrivateModel : public SelectorPrivateConcept {
     }
 
     T data;
+    [[no_unique_address]] SelectorPreparedData<T> prepared;
 };
 }
 
@@ -195,6 +266,12 @@ public:
      */
     bool isCombinator() const;
 
+    /*!
+     * Return whether this selector matches on the position of an element
+     * among its siblings.
+     */
+    bool isStructural() const;
+
     /*
      * Internal.
      *
@@ -3,6 +3,9 @@
 
 #include "Style.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include <EventHelper.h>
 #include <QCoreApplication>
 #include <QGlobalStatic>
@@ -12,7 +15,9 @@
 #include <QTimer>
 #include <QUrl>
 
+#include "ElementQuery.h"
 #include "InputPlugin.h"
+#include "Length.h"
 #include "StyleLoader.h"
 #include "Style_p.h"
 
@@ -25,11 +30,98 @@ using namespace Qt::StringLiterals;
 UNION_EXPORT QEvent::Type StyleChangedEvent::s_type = QEvent::None;
 static EventTypeRegistration<StyleChangedEvent> styleChangedEventRegistration;
 
+// Returns the rules from rules that apply to conditions, in the same order.
+static QList<StyleRule::Ptr> activeRules(const QList<StyleRule::Ptr> &rules, StyleRule::Conditions conditions)
+{
+    QList<StyleRule::Ptr> result;
+    result.reserve(rules.size());
+    std::ranges::copy_if(rules, std::back_inserter(result), [conditions](const auto &rule) {
+        return rule->appliesTo(conditions);
+    });
+    return result;
+}
+
+struct OptimizeResult {
+    qsizetype merged = 0;
+    qsizetype shadowed = 0;
+};
+
+// Merge rules with identical selectors and drop rules that are fully shadowed
+// by a later rule, so fewer rules need to be matched and resolved at query time.
+//
+// Matched rules are sorted by selector weight, with later rules taking
+// precedence over earlier rules of the same weight. Two rules with identical
+// selectors can only be merged if no rule of the same weight is in between, as
+// the merged rule would otherwise change precedence relative to that rule. A
+// rule that only sets properties a later rule with identical selectors also
+// sets never contributes anything, so it can always be dropped.
+static OptimizeResult optimizeRules(QList<StyleRule::Ptr> &rules)
+{
+    OptimizeResult result;
+
+    QList<StyleRule::Ptr> optimized;
+    optimized.reserve(rules.size());
+
+    // Index in optimized of the last rule with given selectors and conditions
+    // and of the last rule with a given weight.
+    QHash<std::pair<QString, int>, qsizetype> lastBySelectors;
+    QHash<int, qsizetype> lastByWeight;
+
+    for (const auto &rule : std::as_const(rules)) {
+        const auto selectors = rule->selectors();
+        const auto weight = selectors.weight();
+        const auto key = std::make_pair(selectors.toString(), rule->conditions().toInt());
+
+        const auto previousIndex = lastBySelectors.value(key, -1);
+        const auto previous = previousIndex >= 0 ? optimized.at(previousIndex) : nullptr;
+
+        if (previous && previous->properties() && rule->properties()) {
+            auto own = std::make_unique<Properties::StylePropertyGroup>();
+            Properties::StylePropertyGroup::resolveProperties(rule->properties(), own.get());
+
+            auto merged = std::make_unique<Properties::StylePropertyGroup>();
+            Properties::StylePropertyGroup::resolveProperties(rule->properties(), merged.get());
+            Properties::StylePropertyGroup::resolveProperties(previous->properties(), merged.get());
+
+            if (*merged == *own) {
+                optimized[previousIndex] = nullptr;
+                result.shadowed++;
+            } else if (lastByWeight.value(weight, -1) == previousIndex) {
+                auto mergedRule = StyleRule::create();
+                mergedRule->setSelectors(selectors);
+                mergedRule->setConditions(rule->conditions());
+                mergedRule->setProperties(std::move(merged));
+                optimized[previousIndex] = mergedRule;
+                result.merged++;
+                continue;
+            }
+        }
+
+        lastBySelectors.insert(key, optimized.size());
+        lastByWeight.insert(weight, optimized.size());
+        optimized.append(rule);
+    }
+
+    optimized.removeAll(nullptr);
+    rules = optimized;
+
+    return result;
+}
+
 Style::Style(std::unique_ptr<StylePrivate> &&d)
     : QObject(nullptr)
     , d(std::move(d))
 {
-    qApp->installEventFilter(this);
+    // Styles restored from the cache are created with their rules already set.
+    this->d->activeRules = activeRules(this->d->rules, this->d->conditions);
+
+    // Styles can be created on a worker thread when loaded asynchronously. In
+    // that case StyleRegistry calls moveToMainThread() once loading finished.
+    if (QThread::currentThread() == qApp->thread()) {
+        qApp->installEventFilter(this);
+        Length::updateContext();
+        this->d->lengthGeneration = Length::contextGeneration();
+    }
 }
 
 Style::~Style() = default;
@@ -65,8 +157,22 @@ StyleLoader *Style::loader() const
 bool Style::load()
 {
     Q_ASSERT_X(d->loader, "Union::Style", "Style requires a StyleLoader instance to function");
-    d->modified = true;
-    return d->loader->load(shared_from_this());
+    d->markModified();
+    if (!d->loader->load(shared_from_this())) {
+        return false;
+    }
+
+    // Input plugins insert rules as they are declared, so optimize them here
+    // rather than in each plugin.
+    const auto ruleCount = d->rules.size();
+    const auto result = optimizeRules(d->rules);
+    d->activeRules = activeRules(d->rules, d->conditions);
+    d->siblingDependencies.reset();
+
+    qCDebug(UNION_GENERAL) << "Optimized rules of style" << d->styleName << "from" << ruleCount << "to" << d->rules.size() << "rules," << result.merged
+                           << "merged and" << result.shadowed << "shadowed";
+
+    return true;
 }
 
 void Style::addCachePath(const std::filesystem::path &path)
@@ -77,12 +183,18 @@ void Style::addCachePath(const std::filesystem::path &path)
 
     d->cachePaths.append(path);
     d->modificationTimes.append(std::filesystem::last_write_time(path));
+    d->markModified();
 }
 
 void Style::insert(StyleRule::Ptr style)
 {
     qCInfo(UNION_QUERY) << "Insert" << style;
     d->rules.append(style);
+    d->markModified();
+    if (style->appliesTo(d->conditions)) {
+        d->activeRules.append(style);
+        d->siblingDependencies.reset();
+    }
 }
 
 QList<StyleRule::Ptr> Style::rules()
@@ -90,15 +202,182 @@ QList<StyleRule::Ptr> Style::rules()
     return d->rules;
 }
 
-QList<StyleRule::Ptr> Union::Style::matches(const QList<Element::Ptr> &elements)
+StyleRule::Conditions Style::conditions() const
 {
-    QList<StyleRule::Ptr> result;
+    return d->conditions;
+}
+
+void Style::setConditions(StyleRule::Conditions conditions)
+{
+    if (conditions == d->conditions) {
+        return;
+    }
+
+    QList<SelectorList> changedSelectors;
+    for (const auto &rule : std::as_const(d->rules)) {
+        if (rule->appliesTo(d->conditions) != rule->appliesTo(conditions)) {
+            changedSelectors.append(rule->selectors());
+        }
+    }
+
+    applyConditions(conditions);
+
+    if (changedSelectors.isEmpty()) {
+        return;
+    }
+
+    qCDebug(UNION_GENERAL) << "Conditions of style" << d->styleName << "changed to" << conditions << "," << changedSelectors.size() << "selectors affected";
+
+    ElementQuery::clearCache();
+
+    StyleChangedEvent event(changedSelectors);
+    QCoreApplication::sendEvent(this, &event);
+}
+
+void Style::applyConditions(StyleRule::Conditions conditions)
+{
+    d->conditions = conditions;
+    d->activeRules = activeRules(d->rules, conditions);
+    d->siblingDependencies.reset();
+}
+
+std::pair<int, int> Style::siblingPosition(int index, int siblingCount)
+{
+    if (!d->siblingDependencies) {
+        StylePrivate::SiblingDependencies dependencies;
+        for (const auto &rule : std::as_const(d->activeRules)) {
+            const auto selectors = rule->selectors();
+            for (const auto &selector : selectors) {
+                switch (selector.type()) {
+                case SelectorType::FirstChild:
+                    dependencies.first = true;
+                    break;
+                case SelectorType::LastChild:
+                    dependencies.last = true;
+                    break;
+                case SelectorType::NthChild:
+                    dependencies.index = true;
+                    break;
+                case SelectorType::NthLastChild:
+                    dependencies.lastIndex = true;
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+        d->siblingDependencies = dependencies;
+    }
+
+    const auto dependencies = d->siblingDependencies.value();
+    if (index < 0) {
+        return std::make_pair(-1, 0);
+    }
+
+    if (dependencies.lastIndex) {
+        return std::make_pair(index, siblingCount);
+    }
+
+    int reducedIndex = -1;
+    if (dependencies.index) {
+        reducedIndex = index;
+    } else if (dependencies.first) {
+        reducedIndex = index == 0 ? 0 : 1;
+    } else if (dependencies.last) {
+        reducedIndex = 0;
+    }
+
+    if (reducedIndex < 0) {
+        return std::make_pair(-1, 0);
+    }
+
+    if (!dependencies.last) {
+        return std::make_pair(reducedIndex, 0);
+    }
+
+    // Pick a sibling count that keeps the element last if, and only if, it was.
+    const auto isLast = index == siblingCount - 1;
+    return std::make_pair(reducedIndex, isLast ? reducedIndex + 1 : reducedIndex + 2);
+}
+
+QList<std::filesystem::path> Style::cachePaths() const
+{
+    return d->cachePaths;
+}
+
+// Groups rules by their selectors. The same selectors may be used by multiple
+// rules, so each entry contains all rules using those selectors in order.
+static QHash<QString, QList<StyleRule::Ptr>> rulesBySelectors(const QList<StyleRule::Ptr> &rules)
+{
+    QHash<QString, QList<StyleRule::Ptr>> result;
+    for (const auto &rule : rules) {
+        result[rule->selectors().toString()].append(rule);
+    }
+    return result;
+}
+
+static bool rulesEqual(const QList<StyleRule::Ptr> &first, const QList<StyleRule::Ptr> &second)
+{
+    return std::ranges::equal(first, second, [](const auto &left, const auto &right) {
+        auto leftProperties = left->properties();
+        auto rightProperties = right->properties();
+        if (!leftProperties || !rightProperties) {
+            return leftProperties == rightProperties;
+        }
+        return *leftProperties == *rightProperties;
+    });
+}
 
+void Style::replaceRules(const Ptr &other)
+{
+    const auto oldRules = rulesBySelectors(d->rules);
+    const auto newRules = rulesBySelectors(other->d->rules);
+
+    QList<SelectorList> changedSelectors;
+    for (auto [key, rules] : oldRules.asKeyValueRange()) {
+        if (!rulesEqual(rules, newRules.value(key))) {
+            changedSelectors.append(rules.first()->selectors());
+        }
+    }
+    for (auto [key, rules] : newRules.asKeyValueRange()) {
+        if (!oldRules.contains(key)) {
+            changedSelectors.append(rules.first()->selectors());
+        }
+    }
+
+    d->rules = other->d->rules;
+    d->activeRules = activeRules(d->rules, d->conditions);
+    d->siblingDependencies.reset();
+    d->cachePaths = other->d->cachePaths;
+    d->modificationTimes = other->d->modificationTimes;
+    d->markModified();
+
+    if (changedSelectors.isEmpty()) {
+        return;
+    }
+
+    qCDebug(UNION_GENERAL) << "Rules of style" << d->styleName << "changed," << changedSelectors.size() << "selectors affected";
+
+    ElementQuery::clearCache();
+
+    StyleChangedEvent event(changedSelectors);
+    QCoreApplication::sendEvent(this, &event);
+}
+
+QList<StyleRule::Ptr> Union::Style::matches(const QList<Element::Ptr> &elements)
+{
     if (d->rules.isEmpty()) {
         qCInfo(UNION_QUERY) << "No style rules found for theme" << d->styleName << "so we will never match anything!";
     }
 
-    for (auto rule : d->rules) {
+    return matches(d->activeRules, elements);
+}
+
+QList<StyleRule::Ptr> Style::matches(const QList<StyleRule::Ptr> &rules, const QList<Element::Ptr> &elements)
+{
+    QList<StyleRule::Ptr> result;
+
+    for (const auto &rule : rules) {
         const auto selectors = rule->selectors();
         if (selectors.matches(elements)) {
             qCDebug(UNION_QUERY) << "Matches selector" << selectors;
@@ -115,6 +394,11 @@ QList<StyleRule::Ptr> Union::Style::matches(const QList<Element::Ptr> &elements)
     return result;
 }
 
+QList<StyleRule::Ptr> Style::activeRules() const
+{
+    return d->activeRules;
+}
+
 std::shared_ptr<Style> Style::create(const QString &pluginName, const QString &styleName, std::unique_ptr<StyleLoader> &&loader)
 {
     auto d = std::make_unique<StylePrivate>();
@@ -124,12 +408,46 @@ std::shared_ptr<Style> Style::create(const QString &pluginName, const QString &s
     return std::make_shared<Style>(std::move(d));
 }
 
+void Style::moveToMainThread()
+{
+    if (thread() == qApp->thread()) {
+        return;
+    }
+
+    // Event filters only work for objects living in the same thread, so move
+    // the style to the main thread and install the filter from there. This
+    // is only done after loading, so the filter never runs during a load.
+    moveToThread(qApp->thread());
+    QMetaObject::invokeMethod(
+        this,
+        [this]() {
+            qApp->installEventFilter(this);
+            Length::updateContext();
+            this->d->lengthGeneration = Length::contextGeneration();
+        },
+        Qt::QueuedConnection);
+}
+
 bool Style::eventFilter(QObject *obj, QEvent *event)
 {
     if (obj == qApp && event->type() == QEvent::ApplicationPaletteChange) {
         StyleChangedEvent event;
         QCoreApplication::sendEvent(this, &event);
     }
+
+    // Lengths using relative units depend on the application font, so let
+    // users know they need to resolve them again. Every style receives this
+    // event but only the first one will actually change the context, so track
+    // the generation per style rather than using the result of updateContext().
+    if (obj == qApp && event->type() == QEvent::ApplicationFontChange) {
+        Length::updateContext();
+        if (d->lengthGeneration != Length::contextGeneration()) {
+            d->lengthGeneration = Length::contextGeneration();
+            StyleChangedEvent event;
+            QCoreApplication::sendEvent(this, &event);
+        }
+    }
+
     return QObject::eventFilter(obj, event);
 }
 
@@ -137,4 +455,28 @@ StyleChangedEvent::StyleChangedEvent()
     : QEvent(s_type)
 {
 }
+
+StyleChangedEvent::StyleChangedEvent(const QList<SelectorList> &changedSelectors)
+    : QEvent(s_type)
+    , m_changedSelectors(changedSelectors)
+{
+}
+
+bool StyleChangedEvent::rulesChanged() const
+{
+    return !m_changedSelectors.isEmpty();
+}
+
+QList<SelectorList> StyleChangedEvent::changedSelectors() const
+{
+    return m_changedSelectors;
+}
+
+bool StyleChangedEvent::affects(const QList<Element::Ptr> &elements) const
+{
+    return std::ranges::any_of(m_changedSelectors, [&elements](const auto &selectors) {
+        return selectors.matches(elements);
+    });
+}
+
 #include "moc_Style.cpp"
@@ -83,12 +83,31 @@ public:
      */
     void addCachePath(const std::filesystem::path &path);
 
+    /*!
+     * Returns the list of files that were used to load this style.
+     */
+    QList<std::filesystem::path> cachePaths() const;
+
     /*!
      * Returns the list of StyleRule instances that matches a given list of
      * Element instances.
      */
     QList<StyleRule::Ptr> matches(const QList<Element::Ptr> &elements);
 
+    /*!
+     * Returns the rules of \a rules that match a given list of Element instances.
+     *
+     * This matches the same way as matches() but against a given list of
+     * rules, for example a copy of activeRules(). As this does not access the
+     * style, it can be used from a different thread while the style changes.
+     */
+    static QList<StyleRule::Ptr> matches(const QList<StyleRule::Ptr> &rules, const QList<Element::Ptr> &elements);
+
+    /*!
+     * Returns the list of rules that apply to the current conditions.
+     */
+    QList<StyleRule::Ptr> activeRules() const;
+
     /*!
      * Insert a new rule into the style.
      *
@@ -101,6 +120,43 @@ public:
      */
     QList<StyleRule::Ptr> rules();
 
+    /*!
+     * The conditions that are currently active for this style.
+     *
+     * Only rules that apply to these conditions are considered by matches().
+     * When the conditions change, a StyleChangedEvent is sent containing the
+     * selectors of all rules that started or stopped applying.
+     */
+    StyleRule::Conditions conditions() const;
+    void setConditions(StyleRule::Conditions conditions);
+
+    /*!
+     * Returns the position to use for an element at \a index of \a siblingCount.
+     *
+     * The result is reduced to what the structural selectors of the active
+     * rules depend on. For example, if only \c{:first-child} is used, all
+     * elements other than the first get the same position. Setting the
+     * reduced position on an element avoids updating elements whose position
+     * changed in a way that does not affect matching, and allows those
+     * elements to share cached query results.
+     *
+     * If no active rule uses structural selectors, this returns an unknown
+     * position of -1 and 0.
+     */
+    std::pair<int, int> siblingPosition(int index, int siblingCount);
+
+    /*!
+     * Replace the rules of this style with those of \a other.
+     *
+     * The rules of both styles are compared by their selectors. A
+     * StyleChangedEvent is sent to this style containing the selectors of all
+     * rules that were added, removed or had their properties changed, so that
+     * only elements matching those selectors need to be updated.
+     *
+     * \a other The style to take the new rules from.
+     */
+    void replaceRules(const Ptr &other);
+
     /*!
      * Create a new instance of Style.
      *
@@ -115,17 +171,44 @@ protected:
     bool eventFilter(QObject *obj, QEvent *event) override;
 
 private:
+    void applyConditions(StyleRule::Conditions conditions);
+    // Move a style that was created on a worker thread to the main thread.
+    // Must be called from the thread that created the style.
+    void moveToMainThread();
+
     friend class StyleRegistry;
     friend class StyleRegistryPrivate;
 
     const std::unique_ptr<StylePrivate> d;
 };
 
-class StyleChangedEvent : public QEvent
+class UNION_EXPORT StyleChangedEvent : public QEvent
 {
 public:
     StyleChangedEvent();
+    StyleChangedEvent(const QList<SelectorList> &changedSelectors);
+
+    /*!
+     * Returns whether the rules of the style changed.
+     *
+     * If this is false, only the environment of the style changed, for
+     * example the application palette.
+     */
+    bool rulesChanged() const;
+
+    /*!
+     * Returns the selectors of the rules that changed.
+     */
+    QList<SelectorList> changedSelectors() const;
+
+    /*!
+     * Returns whether \a elements match any of the rules that changed.
+     */
+    bool affects(const QList<Element::Ptr> &elements) const;
 
     static QEvent::Type s_type;
+
+private:
+    QList<SelectorList> m_changedSelectors;
 };
 }
@@ -22,43 +22,71 @@ namespace fs = std::filesystem;
 static constexpr quint64 CacheMagic = 0x23'55'4E'49'4F'55'43'46;
 // Version of the cache file. Increase this whenever there are changes to the
 // underlying data structures.
-static constexpr uint32_t CacheVersion = 6;
+static constexpr uint32_t CacheVersion = 16;
+
+// The property payload of a cache file.
+//
+// When possible, the payload is memory-mapped read-only from the cache file
+// rather than read into memory. As the mapping is file-backed, its pages are
+// shared between all processes using the same cache file, so each process only
+// needs to allocate memory for the rules it deserializes. Cache files are
+// replaced atomically when saving, so an existing mapping remains valid even if
+// the cache file gets replaced while it is mapped.
+struct CachePayload {
+    ~CachePayload()
+    {
+        if (mapped) {
+            file.unmap(mapped);
+        }
+    }
 
-class StyleCache::Private
-{
-public:
-    QHash<StyleId, fs::path> stylePaths;
+    QFile file;
+    uchar *mapped = nullptr;
+    QByteArray data;
 };
 
-StyleCache::StyleCache()
-    : d(std::make_unique<Private>())
+// Deserialize the properties of a single rule from the property payload.
+static std::unique_ptr<Properties::StylePropertyGroup> readProperties(const QByteArray &payload, quint32 offset, quint32 size)
 {
-    auto cachePath = fs::path(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation).toStdString()) / "union";
-    if (!enabled() || !fs::exists(cachePath)) {
-        return;
-    }
+    // This refers to the existing data of payload, so it does not copy.
+    const auto data = QByteArray::fromRawData(payload.constData() + offset, size);
 
-    for (const auto &pluginEntry : fs::directory_iterator(cachePath)) {
-        if (!pluginEntry.is_directory()) {
-            continue;
-        }
+    QDataStream reader(data);
+    reader.setVersion(QDataStream::Qt_6_9);
 
-        auto pluginName = pluginEntry.path().filename();
-        for (const auto &styleEntry : fs::directory_iterator(pluginEntry.path())) {
-            if (!styleEntry.is_regular_file()) {
-                continue;
-            }
+    bool hasProperties = false;
+    reader >> hasProperties;
 
-            if (styleEntry.file_size() == 0) {
-                continue;
-            }
+    if (!hasProperties) {
+        return nullptr;
+    }
 
-            auto styleName = styleEntry.path().stem();
+    auto properties = std::make_unique<Properties::StylePropertyGroup>();
+    reader >> properties;
 
-            auto styleId = std::make_pair(pluginName.string(), styleName.string());
-            d->stylePaths.insert(styleId, styleEntry.path());
-        }
+    if (reader.status() != QDataStream::Status::Ok) {
+        qCWarning(UNION_GENERAL) << "Failed reading cached properties at offset" << offset;
+        return nullptr;
+    }
+
+    return properties;
+}
+
+class StyleCache::Private
+{
+public:
+    fs::path cacheFilePath(const StyleId &styleId) const
+    {
+        return cachePath / styleId.first / (styleId.second + ".cache"s);
     }
+
+    fs::path cachePath;
+};
+
+StyleCache::StyleCache()
+    : d(std::make_unique<Private>())
+{
+    d->cachePath = fs::path(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation).toStdString()) / "union";
 }
 
 StyleCache::~StyleCache() = default;
@@ -69,9 +97,20 @@ bool Union::StyleCache::enabled() const
     return enabled;
 }
 
+StyleCache::ValidationMode StyleCache::validationMode() const
+{
+    return qEnvironmentVariable("UNION_STYLE_CACHE_VALIDATION") == u"manifest" ? ValidationMode::Manifest : ValidationMode::Files;
+}
+
 bool StyleCache::hasEntry(const StyleId &styleId) const
 {
-    return d->stylePaths.contains(styleId);
+    if (!enabled()) {
+        return false;
+    }
+
+    std::error_code error;
+    auto size = fs::file_size(d->cacheFilePath(styleId), error);
+    return !error && size > 0;
 }
 
 std::unique_ptr<StylePrivate> StyleCache::load(const StyleId &styleId) const
@@ -81,8 +120,8 @@ std::unique_ptr<StylePrivate> StyleCache::load(const StyleId &styleId) const
         return nullptr;
     }
 
-    auto path = d->stylePaths.value(styleId);
-    if (path.empty()) {
+    auto path = d->cacheFilePath(styleId);
+    if (!fs::exists(path)) {
         qCDebug(UNION_GENERAL) << "Ignoring cache for style" << styleId.second << "from plugin" << styleId.first << "because no cache file could be found";
         return nullptr;
     }
@@ -92,12 +131,13 @@ std::unique_ptr<StylePrivate> StyleCache::load(const StyleId &styleId) const
         return nullptr;
     }
 
-    QFile cacheFile(path);
-    if (!cacheFile.open(QIODevice::ReadOnly)) {
+    auto payload = std::make_shared<CachePayload>();
+    payload->file.setFileName(path);
+    if (!payload->file.open(QIODevice::ReadOnly)) {
         return nullptr;
     }
 
-    QDataStream reader(&cacheFile);
+    QDataStream reader(&payload->file);
     reader.setVersion(QDataStream::Qt_6_9);
 
     quint64 magic = 0;
@@ -125,45 +165,125 @@ std::unique_ptr<StylePrivate> StyleCache::load(const StyleId &styleId) const
         return nullptr;
     }
 
+    QList<fs::path> manifestDirectories;
+    QList<fs::file_time_type> manifestModificationTimes;
+    reader >> manifestDirectories;
+    reader >> manifestModificationTimes;
+
     reader >> result->cachePaths;
     reader >> result->modificationTimes;
 
-    if (result->cachePaths.size() != result->modificationTimes.size()) {
+    if (result->cachePaths.size() != result->modificationTimes.size() || manifestDirectories.size() != manifestModificationTimes.size()) {
         qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "mismatch between cache paths and modification times";
         return nullptr;
     }
 
-    for (int i = 0; i < result->cachePaths.size(); ++i) {
-        auto path = result->cachePaths.at(i);
+    if (validationMode() == ValidationMode::Manifest) {
+        // Only check the directories containing the source files. Installed
+        // styles are updated by replacing files, which updates the modification
+        // time of the containing directory, so this needs far fewer stat calls
+        // than checking each individual file.
+        for (qsizetype i = 0; i < manifestDirectories.size(); ++i) {
+            const auto &directory = manifestDirectories.at(i);
+
+            std::error_code error;
+            auto currentModificationTime = fs::last_write_time(directory, error);
+            if (error) {
+                qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "source directory" << directory.string() << "no longer exists";
+                return nullptr;
+            }
 
-        if (!fs::exists(path)) {
-            qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "original file no longer exists";
-            return nullptr;
+            if (currentModificationTime != manifestModificationTimes.at(i)) {
+                qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "source directory modification time mismatch";
+                return nullptr;
+            }
         }
+    } else {
+        for (int i = 0; i < result->cachePaths.size(); ++i) {
+            auto path = result->cachePaths.at(i);
 
-        auto cachedModificationTime = result->modificationTimes.at(i);
-        auto currentModificationTime = fs::last_write_time(path);
+            if (!fs::exists(path)) {
+                qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "original file no longer exists";
+                return nullptr;
+            }
 
-        if (cachedModificationTime != currentModificationTime) {
-            qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "file modification time mismatch";
-            return nullptr;
+            auto cachedModificationTime = result->modificationTimes.at(i);
+            auto currentModificationTime = fs::last_write_time(path);
+
+            if (cachedModificationTime != currentModificationTime) {
+                qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "file modification time mismatch";
+                return nullptr;
+            }
         }
     }
 
     qsizetype count;
     reader >> count;
 
-    for (int i = 0; i < count; ++i) {
+    // Only selectors and conditions are deserialized here, as they are needed
+    // for matching. Properties are stored as one payload with an offset table
+    // and each rule's properties get deserialized when they are first used. This
+    // avoids spending time and memory on rules that are never matched.
+    for (qsizetype i = 0; i < count; ++i) {
+        SelectorList selectors;
+        StyleRule::Conditions conditions;
+        reader >> selectors >> conditions;
+
         auto rule = StyleRule::create();
-        reader >> rule;
+        rule->setSelectors(selectors);
+        rule->setConditions(conditions);
         result->rules.append(rule);
     }
 
+    QList<quint32> offsets;
+    reader >> offsets;
+
+    quint32 payloadSize = 0;
+    reader >> payloadSize;
+
     if (reader.status() != QDataStream::Status::Ok) {
         qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "restoring cached data failed";
         return nullptr;
     }
 
+    const auto payloadOffset = payload->file.pos();
+    if (payloadOffset + payloadSize > payload->file.size()) {
+        qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "file is truncated";
+        return nullptr;
+    }
+
+    if (payloadSize > 0) {
+        // Mapping can be disabled to exercise the fallback. This is read for
+        // every load so it can be changed at runtime, mostly for tests.
+        if (!qEnvironmentVariableIsSet("UNION_STYLE_CACHE_DISABLE_MMAP")) {
+            payload->mapped = payload->file.map(payloadOffset, payloadSize);
+        }
+        if (payload->mapped) {
+            payload->data = QByteArray::fromRawData(reinterpret_cast<const char *>(payload->mapped), payloadSize);
+        } else {
+            qCDebug(UNION_GENERAL) << "Could not map cache file" << path.string() << "reading it instead";
+            payload->data = payload->file.read(payloadSize);
+        }
+    }
+
+    if (offsets.size() != count + 1 || offsets.last() != payloadSize || payload->data.size() != qsizetype(payloadSize)) {
+        qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "invalid property offsets";
+        return nullptr;
+    }
+
+    for (qsizetype i = 0; i < count; ++i) {
+        const auto offset = offsets.at(i);
+        if (offsets.at(i + 1) < offset) {
+            qCDebug(UNION_GENERAL) << "Ignoring cache file" << path.string() << "invalid property offsets";
+            return nullptr;
+        }
+        const auto size = offsets.at(i + 1) - offset;
+
+        result->rules.at(i)->setPropertiesLoader([payload, offset, size]() {
+            return readProperties(payload->data, offset, size);
+        });
+    }
+
     return result;
 }
 
@@ -177,15 +297,31 @@ bool Union::StyleCache::save(const StylePrivate *style) const
         return false;
     }
 
-    auto path = fs::path(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation).toStdString()) / "union" / style->pluginName.toStdString();
-    if (!fs::exists(path)) {
-        if (!fs::create_directories(path)) {
-            qCWarning(UNION_GENERAL) << "Could not create cache path" << path.string();
+    auto path = d->cacheFilePath(std::make_pair(style->pluginName.toStdString(), style->styleName.toStdString()));
+    if (!fs::exists(path.parent_path())) {
+        if (!fs::create_directories(path.parent_path())) {
+            qCWarning(UNION_GENERAL) << "Could not create cache path" << path.parent_path().string();
             return false;
         }
     }
 
-    QSaveFile cacheFile(QString::fromStdString(path / (style->styleName.toStdString() + ".cache"s)));
+    QList<fs::path> manifestDirectories;
+    QList<fs::file_time_type> manifestModificationTimes;
+    for (const auto &sourcePath : std::as_const(style->cachePaths)) {
+        auto directory = sourcePath.parent_path();
+        if (manifestDirectories.contains(directory)) {
+            continue;
+        }
+
+        std::error_code error;
+        auto modificationTime = fs::last_write_time(directory, error);
+        if (!error) {
+            manifestDirectories.append(directory);
+            manifestModificationTimes.append(modificationTime);
+        }
+    }
+
+    QSaveFile cacheFile(QString::fromStdString(path));
     if (!cacheFile.open(QIODevice::WriteOnly)) {
         qCWarning(UNION_GENERAL) << "Could not open cache file" << qPrintable(cacheFile.fileName()) << "for writing";
         return false;
@@ -200,13 +336,38 @@ bool Union::StyleCache::save(const StylePrivate *style) const
     writer << style->pluginName;
     writer << style->styleName;
 
+    writer << manifestDirectories;
+    writer << manifestModificationTimes;
+
     writer << style->cachePaths;
     writer << style->modificationTimes;
 
+    QByteArray payload;
+    QList<quint32> offsets;
+    offsets.reserve(style->rules.size() + 1);
+
+    QDataStream payloadWriter(&payload, QIODevice::WriteOnly);
+    payloadWriter.setVersion(QDataStream::Qt_6_9);
+
     writer << style->rules.size();
     for (const auto &rule : std::as_const(style->rules)) {
-        writer << rule;
+        writer << rule->selectors() << rule->conditions();
+
+        offsets.append(quint32(payloadWriter.device()->pos()));
+
+        auto properties = rule->properties();
+        payloadWriter << bool(properties);
+        if (properties) {
+            payloadWriter << properties;
+        }
     }
+    offsets.append(quint32(payloadWriter.device()->pos()));
+
+    writer << offsets;
+
+    // The payload is written as raw data so it can be memory-mapped when loading.
+    writer << quint32(payload.size());
+    writer.writeRawData(payload.constData(), payload.size());
 
     if (!cacheFile.commit()) {
         qCWarning(UNION_GENERAL) << "Could not commit cache file" << qPrintable(cacheFile.fileName());
@@ -24,11 +24,22 @@ class StylePrivate;
  *
  * Note that if `enabled()` returns false, this class will do nothing.
  */
-class StyleCache
+class UNION_EXPORT StyleCache
 {
 public:
     using StyleId = std::pair<std::string, std::string>;
 
+    // How to verify that cached data is still up to date.
+    enum class ValidationMode {
+        // Compare the modification time of each source file.
+        Files,
+        // Compare the modification times of the directories containing the
+        // source files. This requires fewer filesystem calls but will not
+        // detect files that are modified in place, so it is intended for
+        // installed styles.
+        Manifest,
+    };
+
     StyleCache();
     ~StyleCache();
 
@@ -38,9 +49,16 @@ public:
     // set.
     bool enabled() const;
 
+    // The validation mode used when loading cached data.
+    //
+    // This is Files by default and can be changed to Manifest by setting the
+    // UNION_STYLE_CACHE_VALIDATION environment variable to "manifest".
+    ValidationMode validationMode() const;
+
     // Does a cache entry exist for the given style ID.
     //
     // Note that this is based on whether a cache file exists for the given ID.
+    // The cache file is looked up directly, the cache directory is not scanned.
     // It does not verify that the cache file actually loads properly, so this
     // may return true while load() still ends up returning nullptr.
     bool hasEntry(const StyleId &styleId) const;
@@ -51,6 +69,9 @@ public:
     // data may not be loaded for a number of reasons, including changes to the
     // underlying style files as well as changes to the code or structure of
     // cache files.
+    //
+    // Only the selectors of rules are deserialized by this. The properties of
+    // each rule are deserialized when they are first requested.
     std::unique_ptr<StylePrivate> load(const StyleId &styleId) const;
 
     // Save the style data to a cache file.
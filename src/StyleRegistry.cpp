@@ -3,12 +3,20 @@
 
 #include "StyleRegistry.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <optional>
+#include <ranges>
 
+#include <QFileSystemWatcher>
 #include <QGuiApplication>
 #include <QJsonArray>
+#include <QMutex>
 #include <QPluginLoader>
+#include <QPromise>
 #include <QThread>
+#include <QThreadPool>
+#include <QTimer>
 
 #include "PluginRegistry.h"
 #include "Style.h"
@@ -37,26 +45,78 @@ public:
         : inputRegistry{std::make_shared<PluginRegistry<InputPlugin>>(u"input"_s)}
         , platformRegistry{std::make_shared<PluginRegistry<PlatformPlugin>>(u"platform"_s)}
     {
+        // Use a single thread for writing, so writes to the same cache file
+        // never happen concurrently.
+        savePool.setMaxThreadCount(1);
     }
 
     Style::Ptr loadStyle(const QString &styleName, const QString &pluginName)
     {
         auto styleId = std::make_pair(pluginName.toStdString(), styleName.toStdString());
-        if (styles.contains(styleId)) {
-            return styles.value(styleId);
+
+        // Styles may be loaded from worker threads. The mutex is only held for
+        // looking up and inserting styles, so different styles can be loaded
+        // concurrently. A thread requesting a style that is already being
+        // loaded by another thread waits for that load to finish instead.
+        QPromise<Style::Ptr> promise;
+        StyleCache *cache = nullptr;
+        {
+            QMutexLocker locker(&mutex);
+
+            if (styles.contains(styleId)) {
+                return styles.value(styleId);
+            }
+
+            if (!styleCache) {
+                return nullptr;
+            }
+
+            if (auto itr = loadingStyles.constFind(styleId); itr != loadingStyles.constEnd()) {
+                auto future = itr.value();
+                locker.unlock();
+                return future.result();
+            }
+
+            cache = styleCache.get();
+            loadingStyles.insert(styleId, promise.future());
         }
 
-        if (!styleCache) {
-            return nullptr;
+        promise.start();
+
+        auto style = createStyle(cache, styleId, styleName, pluginName);
+        if (style) {
+            // Only hand the style to the main thread once it is fully loaded.
+            style->moveToMainThread();
+
+            QMutexLocker locker(&mutex);
+            applyConditions(style);
+            styles.insert(styleId, style);
+        }
+
+        {
+            QMutexLocker locker(&mutex);
+            loadingStyles.remove(styleId);
         }
 
-        if (styleCache->hasEntry(styleId)) {
-            auto data = styleCache->load(styleId);
+        promise.addResult(style);
+        promise.finish();
+
+        if (style) {
+            watchStyle(style);
+        }
+
+        return style;
+    }
+
+    // Create and load a style, either from the cache or from its input plugin.
+    // This is called without the mutex held.
+    Style::Ptr createStyle(StyleCache *cache, const StyleCache::StyleId &styleId, const QString &styleName, const QString &pluginName)
+    {
+        if (cache->hasEntry(styleId)) {
+            auto data = cache->load(styleId);
             if (data) {
-                auto style = std::make_shared<Style>(std::move(data));
                 qCDebug(UNION_GENERAL) << "Loaded style" << styleName << "from cached data";
-                styles.insert(styleId, style);
-                return style;
+                return std::make_shared<Style>(std::move(data));
             }
         }
 
@@ -65,7 +125,12 @@ public:
             return nullptr;
         }
 
-        auto plugin = inputRegistry->pluginObject(pluginName);
+        InputPlugin *plugin = nullptr;
+        {
+            QMutexLocker locker(&mutex);
+            plugin = inputRegistry->pluginObject(pluginName);
+        }
+
         if (!plugin) {
             qCWarning(UNION_GENERAL) << "Requested style" << styleName << "from plugin" << pluginName << "but the plugin could not be found!";
             return nullptr;
@@ -84,16 +149,172 @@ public:
 
         qCDebug(UNION_GENERAL) << "Loaded style" << styleName << "from plugin" << pluginName;
 
-        styles.insert(styleId, style);
+        scheduleSave(style);
         return style;
     }
 
+    // Apply the platform's conditions to a newly loaded style. This may happen
+    // on a worker thread, so this does not send any events. Needs mutex held.
+    void applyConditions(const Style::Ptr &style)
+    {
+        if (conditions) {
+            style->applyConditions(conditions.value());
+        }
+    }
+
+    // Update the active conditions of all loaded styles after the platform was
+    // loaded or its conditions changed. Only called on the main thread.
+    void updateConditions()
+    {
+        QList<Style::Ptr> loadedStyles;
+        auto newConditions = platform->conditions();
+        {
+            QMutexLocker locker(&mutex);
+            if (conditions == newConditions) {
+                return;
+            }
+            conditions = newConditions;
+            loadedStyles = styles.values();
+        }
+
+        qCDebug(UNION_GENERAL) << "Platform conditions changed to" << newConditions;
+
+        for (const auto &style : std::as_const(loadedStyles)) {
+            style->setConditions(newConditions);
+        }
+    }
+
+    // Watch the files a style was loaded from and reload the style when any of
+    // them change. This is mostly useful when developing a style, so it is only
+    // enabled when UNION_STYLE_HOT_RELOAD is set.
+    void watchStyle(const Style::Ptr &style)
+    {
+        static const bool HotReload = qEnvironmentVariableIsSet("UNION_STYLE_HOT_RELOAD");
+        if (!HotReload) {
+            return;
+        }
+
+        // Styles always live on the main thread, so create the watcher there.
+        QMetaObject::invokeMethod(qApp, [this, weakStyle = std::weak_ptr(style)]() {
+            auto style = weakStyle.lock();
+            if (!style) {
+                return;
+            }
+
+            auto watcher = new QFileSystemWatcher(style.get());
+
+            // Editors tend to write files in multiple steps, so wait a little
+            // before reloading to avoid reloading partially written files.
+            auto timer = new QTimer(watcher);
+            timer->setSingleShot(true);
+            timer->setInterval(100);
+
+            QObject::connect(watcher, &QFileSystemWatcher::fileChanged, timer, qOverload<>(&QTimer::start));
+            QObject::connect(timer, &QTimer::timeout, watcher, [this, watcher, weakStyle]() {
+                if (auto style = weakStyle.lock()) {
+                    reloadStyle(style, watcher);
+                }
+            });
+
+            updateWatchedPaths(watcher, style->cachePaths());
+        });
+    }
+
+    // Reload a style from its input plugin and replace the rules of the style
+    // with the reloaded rules.
+    //
+    // Note that this reloads the entire style rather than only the changed
+    // files. Input plugins resolve things across files while loading, for
+    // example the CSS plugin resolves imports and substitutes custom
+    // properties declared in other files, so a single file cannot be parsed in
+    // isolation. Replacing the rules only sends changes for the selectors that
+    // actually changed, so the cost of this is limited to parsing.
+    void reloadStyle(const Style::Ptr &style, QFileSystemWatcher *watcher)
+    {
+        // Editors and version control tools may touch files without changing
+        // them, so skip reloading if no file was actually modified.
+        const auto paths = style->d->cachePaths;
+        const auto modificationTimes = style->d->modificationTimes;
+        const bool changed = std::ranges::any_of(std::views::iota(qsizetype(0), paths.size()), [&](qsizetype index) {
+            std::error_code error;
+            return std::filesystem::last_write_time(paths.at(index), error) != modificationTimes.at(index) || error;
+        });
+        if (!changed) {
+            updateWatchedPaths(watcher, paths);
+            return;
+        }
+
+        InputPlugin *plugin = nullptr;
+        {
+            QMutexLocker locker(&mutex);
+            plugin = inputRegistry->pluginObject(style->pluginName());
+        }
+
+        if (!plugin) {
+            qCWarning(UNION_GENERAL) << "Could not reload style" << style->name() << "as plugin" << style->pluginName() << "could not be found";
+            return;
+        }
+
+        auto reloaded = plugin->createStyle(style->name());
+        if (!reloaded || !reloaded->load()) {
+            qCWarning(UNION_GENERAL) << "Could not reload style" << style->name() << "from plugin" << style->pluginName();
+            return;
+        }
+
+        qCDebug(UNION_GENERAL) << "Reloaded style" << style->name() << "from plugin" << style->pluginName();
+
+        style->replaceRules(reloaded);
+        style->setHasErrors(reloaded->hasErrors());
+
+        updateWatchedPaths(watcher, style->cachePaths());
+        scheduleSave(style);
+    }
+
+    void updateWatchedPaths(QFileSystemWatcher *watcher, const QList<std::filesystem::path> &paths)
+    {
+        // Files that are replaced rather than modified are no longer watched,
+        // so always rebuild the full list of watched files.
+        if (!watcher->files().isEmpty()) {
+            watcher->removePaths(watcher->files());
+        }
+
+        QStringList files;
+        for (const auto &path : paths) {
+            files.append(QString::fromStdString(path.string()));
+        }
+        watcher->addPaths(files);
+    }
+
+    // Write the style's data to the cache on a worker thread.
+    //
+    // This avoids having to write the cache during application shutdown and
+    // ensures the cache gets written even if the application does not shut
+    // down cleanly.
+    //
+    // The style may be changed while the worker is writing, so this writes a
+    // snapshot of the style's data taken when scheduling. The style is only
+    // marked as saved if it was not changed after the snapshot was taken.
+    void scheduleSave(const Style::Ptr &style)
+    {
+        if (!styleCache || !styleCache->enabled() || !style->d->isModified()) {
+            return;
+        }
+
+        savePool.start([cache = styleCache.get(), style, snapshot = std::shared_ptr<StylePrivate>(style->d->cacheSnapshot())]() {
+            if (cache->save(snapshot.get())) {
+                qCDebug(UNION_GENERAL) << "Wrote cache for style" << snapshot->styleName << "from plugin" << snapshot->pluginName;
+                style->d->savedGeneration = snapshot->generation.load();
+            }
+        });
+    }
+
     void loadPlatform()
     {
         const auto forcedPlatform = qEnvironmentVariable("UNION_FORCE_PLATFORM", QString{});
         if (!forcedPlatform.isEmpty()) {
             platform = std::shared_ptr<PlatformPlugin>(platformRegistry->pluginObject(forcedPlatform));
             if (platform) {
+                platformLoaded();
                 return;
             }
         }
@@ -132,8 +353,54 @@ public:
             qCCritical(UNION_GENERAL) << "Creating a default fallback platform plugin";
             platform = std::make_shared<FallbackPlatformPlugin>();
         }
+
+        platformLoaded();
+    }
+
+    void platformLoaded()
+    {
+        updateConditions();
+
+        QObject::connect(platform.get(), &PlatformPlugin::conditionsChanged, platform.get(), [this]() {
+            updateConditions();
+        });
+    }
+
+    std::pair<QString, QString> defaultStyleId()
+    {
+        static auto environmentPlugin = qEnvironmentVariable("UNION_STYLE_PLUGIN", QString{});
+        static auto environmentName = qEnvironmentVariable("UNION_STYLE_NAME", QString{});
+
+        if (!platform) {
+            loadPlatform();
+        }
+
+        auto plugin = environmentPlugin;
+        if (plugin.isEmpty()) {
+            plugin = platform->defaultInputPlugin();
+        }
+
+        auto name = environmentName;
+        if (name.isEmpty()) {
+            name = platform->defaultStyleName();
+        }
+
+        return std::make_pair(name, plugin);
+    }
+
+    QList<QString> loadedInputPlugins()
+    {
+        QMutexLocker locker(&mutex);
+        return inputRegistry->pluginObjects();
     }
 
+    // Protects styles, loadingStyles, pendingLoads, styleCache and loading of
+    // input plugins.
+    QMutex mutex;
+    // Styles that are currently being loaded by some thread.
+    QHash<StyleCache::StyleId, QFuture<Style::Ptr>> loadingStyles;
+    QList<QFuture<Style::Ptr>> pendingLoads;
+
     std::unique_ptr<StyleCache> styleCache;
 
     std::shared_ptr<PluginRegistry<InputPlugin>> inputRegistry;
@@ -141,6 +408,12 @@ public:
 
     std::shared_ptr<PluginRegistry<PlatformPlugin>> platformRegistry;
     std::shared_ptr<PlatformPlugin> platform;
+    // The conditions of the platform, once it has been loaded. Protected by mutex.
+    std::optional<StyleRule::Conditions> conditions;
+
+    // Declared last so it is destroyed first, which waits for pending writes
+    // before the cache is destroyed.
+    QThreadPool savePool;
 };
 
 StyleRegistry::StyleRegistry(std::unique_ptr<StyleRegistryPrivate> &&d)
@@ -157,35 +430,65 @@ StyleRegistry::~StyleRegistry() = default;
 
 void StyleRegistry::load()
 {
+    QMutexLocker locker(&d->mutex);
     if (!d->styleCache) {
         d->styleCache = std::make_unique<StyleCache>();
     }
 }
 
-void StyleRegistry::save()
+QFuture<std::shared_ptr<Style>> StyleRegistry::loadAsync()
 {
-    for (const auto &style : std::as_const(d->styles)) {
-        if (style->d->modified) {
-            d->styleCache->save(style->d.get());
-        }
+    // Platform plugins may depend on things that only work on the main thread,
+    // so determine the default style here rather than on the worker thread.
+    const auto [name, plugin] = d->defaultStyleId();
+    return styleAsync(name, plugin);
+}
+
+QFuture<std::shared_ptr<Style>> StyleRegistry::styleAsync(const QString &styleName, const QString &pluginName)
+{
+    auto promise = std::make_shared<QPromise<Style::Ptr>>();
+    auto future = promise->future();
+
+    {
+        QMutexLocker locker(&d->mutex);
+        d->pendingLoads.removeIf([](const auto &pending) {
+            return pending.isFinished();
+        });
+        d->pendingLoads.append(future);
     }
+
+    QThreadPool::globalInstance()->start([this, promise, styleName, pluginName]() {
+        promise->start();
+        load();
+        promise->addResult(style(styleName, pluginName));
+        promise->finish();
+    });
+
+    return future;
 }
 
-std::shared_ptr<Style> StyleRegistry::defaultStyle()
+void StyleRegistry::save()
 {
-    static auto environmentPlugin = qEnvironmentVariable("UNION_STYLE_PLUGIN", QString{});
-    static auto environmentName = qEnvironmentVariable("UNION_STYLE_NAME", QString{});
+    d->savePool.waitForDone();
 
-    auto plugin = environmentPlugin;
-    if (plugin.isEmpty()) {
-        plugin = platform()->defaultInputPlugin();
+    QMutexLocker locker(&d->mutex);
+    if (!d->styleCache) {
+        return;
     }
 
-    auto name = environmentName;
-    if (name.isEmpty()) {
-        name = platform()->defaultStyleName();
+    for (const auto &style : std::as_const(d->styles)) {
+        if (style->d->isModified()) {
+            auto snapshot = style->d->cacheSnapshot();
+            if (d->styleCache->save(snapshot.get())) {
+                style->d->savedGeneration = snapshot->generation.load();
+            }
+        }
     }
+}
 
+std::shared_ptr<Style> StyleRegistry::defaultStyle()
+{
+    const auto [name, plugin] = d->defaultStyleId();
     return style(name, plugin);
 }
 
@@ -200,7 +503,7 @@ std::shared_ptr<Style> StyleRegistry::style(const QString &styleName, const QStr
     // returns a valid style for styleName.
 
     // First search through already-loaded plugins
-    const auto objects = d->inputRegistry->pluginObjects();
+    const auto objects = d->loadedInputPlugins();
     for (const auto &object : objects) {
         if (auto style = d->loadStyle(styleName, object); style) {
             return style;
@@ -222,6 +525,8 @@ std::shared_ptr<Style> StyleRegistry::style(const QString &styleName, const QStr
 
 void Union::StyleRegistry::addStyle(const std::shared_ptr<Style> &style)
 {
+    QMutexLocker locker(&d->mutex);
+
     auto styleId = std::make_pair(style->pluginName().toStdString(), style->name().toStdString());
     if (d->styles.contains(styleId)) {
         qCWarning(UNION_GENERAL) << "A style from plugin" << style->pluginName() << "with name" << style->name() << "is already registered";
@@ -244,6 +549,24 @@ void StyleRegistry::cleanup()
 {
     auto instance = StyleRegistry::instance();
 
+    // Make sure nothing is still loading on a different thread while we clean
+    // up. Loading needs the mutex, so do not hold it while waiting.
+    while (true) {
+        QList<QFuture<Style::Ptr>> pending;
+        {
+            QMutexLocker locker(&instance->d->mutex);
+            pending = std::exchange(instance->d->pendingLoads, {});
+        }
+
+        if (pending.isEmpty()) {
+            break;
+        }
+
+        for (auto &future : pending) {
+            future.waitForFinished();
+        }
+    }
+
     instance->save();
 
     instance->d->styles.clear();
@@ -5,6 +5,7 @@
 
 #include <memory>
 
+#include <QFuture>
 #include <QObject>
 
 #include "InputPlugin.h"
@@ -41,8 +42,28 @@ public:
      * Load any cached data from disk.
      */
     void load();
+    /*!
+     * Load cached data and the default Style asynchronously.
+     *
+     * This determines the default style on the calling thread, then performs
+     * loading of cached data and of the default style on a worker thread. This
+     * should be called as early as possible, for example during plugin
+     * initialization, so that the style is ready by the time it is needed.
+     *
+     * Requesting a style that is still being loaded, for example through
+     * defaultStyle(), will wait for loading to finish.
+     *
+     * Returns a future that will contain the default Style once loading has
+     * finished, or \c{nullptr} if it could not be loaded.
+     */
+    QFuture<std::shared_ptr<Style>> loadAsync();
     /*!
      * Save data to disk for caching.
+     *
+     * Styles are written to the cache on a worker thread after they have been
+     * loaded. This waits for any pending writes to finish and then writes any
+     * style that has not been written yet, so once this returns all data has
+     * been written to disk.
      */
     void save();
     /*!
@@ -62,6 +83,16 @@ public:
      * `nullptr` if it could not be found.
      */
     std::shared_ptr<Style> style(const QString &styleName, const QString &pluginName = QString{});
+    /*!
+     * Get a style instance by name, loading it on a worker thread.
+     *
+     * This behaves the same as style(), except that loading of the style is
+     * done on a worker thread.
+     *
+     * Returns a future that will contain the Style once loading has finished,
+     * or \c{nullptr} if it could not be found.
+     */
+    QFuture<std::shared_ptr<Style>> styleAsync(const QString &styleName, const QString &pluginName = QString{});
 
     /*!
      * Programatically add a style to the registry.
@@ -3,6 +3,9 @@
 
 #include "StyleRule.h"
 
+#include <atomic>
+#include <mutex>
+
 #include <QHash>
 
 using namespace Union;
@@ -10,8 +13,27 @@ using namespace Union;
 class Union::StyleRulePrivate
 {
 public:
+    void loadProperties()
+    {
+        std::lock_guard lock(mutex);
+        if (!propertiesLoader) {
+            return;
+        }
+
+        properties = propertiesLoader();
+        propertiesLoader = nullptr;
+        hasPropertiesLoader = false;
+    }
+
     SelectorList selectors;
+    StyleRule::Conditions conditions;
     std::unique_ptr<Properties::StylePropertyGroup> properties;
+
+    std::function<std::unique_ptr<Properties::StylePropertyGroup>()> propertiesLoader;
+    // Checked without locking in properties() so we only pay for the lock while
+    // there is still something to load.
+    std::atomic_bool hasPropertiesLoader = false;
+    std::mutex mutex;
 };
 
 StyleRule::StyleRule(std::unique_ptr<StyleRulePrivate> &&d)
@@ -32,14 +54,44 @@ void StyleRule::setSelectors(const SelectorList &selectors)
     d->selectors = selectors;
 }
 
+StyleRule::Conditions StyleRule::conditions() const
+{
+    return d->conditions;
+}
+
+void StyleRule::setConditions(Conditions conditions)
+{
+    d->conditions = conditions;
+}
+
+bool StyleRule::appliesTo(Conditions activeConditions) const
+{
+    return (d->conditions & activeConditions) == d->conditions;
+}
+
 Properties::StylePropertyGroup *StyleRule::properties() const
 {
+    if (d->hasPropertiesLoader) {
+        d->loadProperties();
+    }
+
     return d->properties.get();
 }
 
 void StyleRule::setProperties(std::unique_ptr<Properties::StylePropertyGroup> &&newProperties)
 {
+    std::lock_guard lock(d->mutex);
     d->properties = std::move(newProperties);
+    d->propertiesLoader = nullptr;
+    d->hasPropertiesLoader = false;
+}
+
+void StyleRule::setPropertiesLoader(std::function<std::unique_ptr<Properties::StylePropertyGroup>()> &&loader)
+{
+    std::lock_guard lock(d->mutex);
+    d->properties.reset();
+    d->propertiesLoader = std::move(loader);
+    d->hasPropertiesLoader = bool(d->propertiesLoader);
 }
 
 StyleRule::Ptr StyleRule::create()
@@ -50,13 +102,18 @@ StyleRule::Ptr StyleRule::create()
 QDebug operator<<(QDebug debug, std::shared_ptr<Union::StyleRule> style)
 {
     QDebugStateSaver saver(debug);
-    debug.nospace() << "StyleRule(" << style->selectors() << ")";
+    debug.nospace() << "StyleRule(" << style->selectors();
+    if (style->conditions()) {
+        debug << ", " << style->conditions();
+    }
+    debug << ")";
     return debug;
 }
 
 QDataStream &operator<<(QDataStream &stream, const std::shared_ptr<Union::StyleRule> &rule)
 {
     stream << rule->selectors();
+    stream << rule->conditions();
 
     stream << (rule->properties() ? true : false);
 
@@ -73,6 +130,10 @@ QDataStream &operator>>(QDataStream &stream, std::shared_ptr<Union::StyleRule> &
     stream >> selectors;
     rule->setSelectors(selectors);
 
+    Union::StyleRule::Conditions conditions;
+    stream >> conditions;
+    rule->setConditions(conditions);
+
     bool hasProperties;
     stream >> hasProperties;
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 
@@ -36,15 +37,67 @@ class UNION_EXPORT StyleRule : public QObject, public std::enable_shared_from_th
 public:
     using Ptr = std::shared_ptr<StyleRule>;
 
+    /*!
+     * Conditions of the environment that a rule can depend on.
+     *
+     * \value None No condition.
+     * \value Desktop The application runs on a desktop form factor.
+     * \value Mobile The application runs on a mobile form factor.
+     * \value LeftToRight The layout direction is left to right.
+     * \value RightToLeft The layout direction is right to left.
+     * \value StandardMotion Animations are not reduced.
+     * \value ReducedMotion The user prefers reduced motion.
+     * \value StandardContrast Contrast is not increased.
+     * \value HighContrast The user prefers high contrast.
+     */
+    enum class Condition : quint32 {
+        None = 0,
+        Desktop = 1 << 0,
+        Mobile = 1 << 1,
+        LeftToRight = 1 << 2,
+        RightToLeft = 1 << 3,
+        StandardMotion = 1 << 4,
+        ReducedMotion = 1 << 5,
+        StandardContrast = 1 << 6,
+        HighContrast = 1 << 7,
+    };
+    Q_DECLARE_FLAGS(Conditions, Condition)
+    Q_FLAG(Conditions)
+
     StyleRule(std::unique_ptr<StyleRulePrivate> &&d);
     ~StyleRule() override;
 
     SelectorList selectors() const;
     void setSelectors(const SelectorList &selectors);
 
+    /*!
+     * The conditions that need to be active for this rule to apply.
+     *
+     * A rule without any conditions always applies.
+     */
+    Conditions conditions() const;
+    void setConditions(Conditions conditions);
+
+    /*!
+     * Returns true if this rule applies when \a activeConditions are active.
+     */
+    bool appliesTo(Conditions activeConditions) const;
+
     Properties::StylePropertyGroup *properties() const;
     void setProperties(std::unique_ptr<Properties::StylePropertyGroup> &&newProperties);
 
+    /*
+     * Internal.
+     *
+     * Set a function that will be used to load the properties of this rule
+     * when they are first requested through properties(). This allows
+     * deferring the creation of properties until they are actually needed,
+     * which is used by the style cache to avoid deserializing the properties
+     * of rules that are never matched. Calling setProperties() will discard
+     * any pending loader.
+     */
+    void setPropertiesLoader(std::function<std::unique_ptr<Properties::StylePropertyGroup>()> &&loader);
+
     static Ptr create();
 
 private:
@@ -53,6 +106,8 @@ private:
 
 }
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(Union::StyleRule::Conditions)
+
 UNION_EXPORT QDebug operator<<(QDebug debug, std::shared_ptr<Union::StyleRule> style);
 
 QDataStream &operator<<(QDataStream &stream, const std::shared_ptr<Union::StyleRule> &rule);
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <filesystem>
+#include <optional>
 
 #include <QList>
 #include <QString>
@@ -21,13 +23,63 @@ public:
     QString pluginName;
     QString styleName;
 
-    bool modified = false;
+    // Incremented whenever the data that is written to the cache changes.
+    // savedGeneration is the generation that was last written to the cache,
+    // which happens on a worker thread, so the style is modified whenever they
+    // differ.
+    std::atomic<quint64> generation = 0;
+    std::atomic<quint64> savedGeneration = 0;
     bool hasErrors = false;
+    // The Length context generation the users of this style were last notified of.
+    quint64 lengthGeneration = 0;
 
     QList<std::filesystem::path> cachePaths;
     QList<std::filesystem::file_time_type> modificationTimes;
 
     QList<StyleRule::Ptr> rules;
+
+    // The conditions that are active for this style and the rules that apply
+    // to them, in the same order as rules. Matching only considers activeRules
+    // so rules for inactive conditions do not need to be checked every time.
+    StyleRule::Conditions conditions = StyleRule::Condition::Desktop | StyleRule::Condition::LeftToRight | StyleRule::Condition::StandardMotion
+        | StyleRule::Condition::StandardContrast;
+    QList<StyleRule::Ptr> activeRules;
+
+    // Which kinds of structural selectors are used by activeRules. Computed
+    // when first needed and reset whenever activeRules changes.
+    struct SiblingDependencies {
+        bool first = false;
+        bool last = false;
+        bool index = false;
+        bool lastIndex = false;
+    };
+    std::optional<SiblingDependencies> siblingDependencies;
+
+    bool isModified() const
+    {
+        return generation != savedGeneration;
+    }
+
+    void markModified()
+    {
+        generation++;
+    }
+
+    // Create a copy of the data that is written to the cache.
+    //
+    // Rules are not modified after they were created, so they are shared with
+    // the copy rather than copied.
+    std::unique_ptr<StylePrivate> cacheSnapshot() const
+    {
+        auto result = std::make_unique<StylePrivate>();
+        result->pluginName = pluginName;
+        result->styleName = styleName;
+        result->generation = generation.load();
+        result->cachePaths = cachePaths;
+        result->modificationTimes = modificationTimes;
+        result->rules = rules;
+        return result;
+    }
 };
 
 }
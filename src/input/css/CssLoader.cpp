@@ -3,19 +3,27 @@
 
 #include "CssLoader.h"
 
+#include <latch>
 #include <source_location>
 
 #include <QFile>
-#include <QMetaEnum>
+#include <QGlobalStatic>
 #include <QRegularExpression>
 #include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QThreadPool>
 
 #include <Color.h>
+#include <EnumKeywords.h>
+#include <Length.h>
 #include <Style.h>
 #include <StyleRule.h>
 
 #include <CssParser.h>
 
+#include "CssPreprocessor.h"
+#include "CssPseudoClass.h"
+#include "CssPropertyTable.h"
 #include "css_logging.h"
 
 using namespace Qt::StringLiterals;
@@ -23,6 +31,18 @@ using namespace std::string_literals;
 
 namespace fs = std::filesystem;
 
+// Rules are converted using a separate thread pool, as styles may be loaded
+// from a thread in the global pool, which would then block on its own pool.
+Q_GLOBAL_STATIC(QThreadPool, s_convertPool)
+
+// Converting a rule is cheap, so avoid spreading small amounts of rules over
+// multiple threads.
+static constexpr std::size_t MinimumChunkSize = 32;
+
+// cxx-rust-cssparser does not support @media, so conditions are written as
+// pseudo-classes with this prefix, like ":root:media-mobile button".
+static constexpr std::string_view ConditionPrefix = "media-";
+
 template<typename Target, typename Getter, typename Setter>
 struct PropertyGroupBuilder {
     using PropertyGroup = std::remove_pointer_t<std::invoke_result_t<Getter, Target *>>;
@@ -64,23 +84,31 @@ struct PropertyGroupBuilder {
     Setter setter;
 };
 
-inline float to_px(const cssparser::Dimension &value)
+// Lengths in relative units are kept as-is, they are resolved to pixels when
+// they are used.
+inline Length to_length(const cssparser::Dimension &value)
 {
     switch (value.unit()) {
     case cssparser::Dimension::Unit::Px:
-        return value.value();
+        return Length(value.value());
+    case cssparser::Dimension::Unit::Pt:
+        return Length(value.value(), Length::Unit::Points);
+    case cssparser::Dimension::Unit::Em:
+        return Length(value.value(), Length::Unit::Em);
+    case cssparser::Dimension::Unit::Rem:
+        return Length(value.value(), Length::Unit::Rem);
     default:
-        return 0.0;
+        return Length();
     }
 }
 
-inline float to_px(const cssparser::Value &value)
+inline Length to_length(const cssparser::Value &value)
 {
     if (value.type() != cssparser::Value::Type::Dimension) {
-        return 0.0;
+        return Length();
     }
 
-    return to_px(value.get<cssparser::Dimension>());
+    return to_length(value.get<cssparser::Dimension>());
 }
 
 inline float to_number(const cssparser::Value &value)
@@ -152,7 +180,9 @@ inline Color to_color(const cssparser::Value &value)
         return Color{};
     }
 
-    return to_color(value.get<cssparser::Color::Color>());
+    // Evaluate operations on constant colors once while loading, rather than
+    // every time the color is used.
+    return to_color(value.get<cssparser::Color::Color>()).folded();
 }
 
 inline fs::path to_path(const cssparser::Value &value)
@@ -180,7 +210,8 @@ inline QVariant to_qvariant(const cssparser::Value &value)
     case cssparser::Value::Type::Empty:
         return QVariant{};
     case cssparser::Value::Type::Dimension:
-        return to_px(value);
+        // Keep the unit, relative lengths are resolved when matching.
+        return QVariant::fromValue(to_length(value));
     case cssparser::Value::Type::String:
         return QString::fromStdString(value.get<std::string>());
     case cssparser::Value::Type::Color:
@@ -196,19 +227,11 @@ inline QVariant to_qvariant(const cssparser::Value &value)
 }
 
 template<typename T>
-inline int toEnumIntValue(/* intentional copy */ std::string value)
+inline int toEnumIntValue(const std::string &value)
 {
-    const auto metaEnum = QMetaEnum::fromType<T>();
-
-    std::erase(value, '-');
-
-    auto count = metaEnum.keyCount();
-    for (int i = 0; i < count; ++i) {
-        if (qstrnicmp(metaEnum.key(i), value.c_str(), value.size()) == 0) {
-            return metaEnum.value(i);
-        }
+    if (auto result = enumFromKeyword<T>(value)) {
+        return int(result.value());
     }
-
     return -1;
 }
 
@@ -242,145 +265,158 @@ inline void setImage(T *output, const fs::path &rootPath, const cssparser::Prope
     }
 }
 
-template<typename T>
-inline void setAlignment(T *output, const cssparser::Property &property)
+// Calls function with the alignment of the group returned by getter, creating
+// the group and alignment if needed.
+template<typename Getter, typename Setter, typename Function>
+inline void updateAlignment(StylePropertyGroup *output, Getter getter, Setter setter, Function &&function)
 {
-    std::unique_ptr<AlignmentPropertyGroup> tempAlignment;
-    AlignmentPropertyGroup *alignment;
-    if (output->alignment()) {
-        alignment = output->alignment();
-    } else {
-        tempAlignment = std::make_unique<AlignmentPropertyGroup>();
-        alignment = tempAlignment.get();
+    PropertyGroupBuilder group(output, getter, setter);
+    using Group = typename decltype(group)::PropertyGroup;
+    PropertyGroupBuilder alignment(group.instance, &Group::alignment, &Group::setAlignment);
+    function(alignment.instance);
+}
+
+inline void setAlignmentShorthand(AlignmentPropertyGroup *alignment, const cssparser::Property &property)
+{
+    if (property.values().size() != 4) {
+        qCDebug(UNION_CSS) << "Ignoring" << QByteArrayView(property.name()) << "as it does not have four values";
+        return;
     }
 
-    if (property.name().ends_with("alignment-container"s)) {
-        alignment->setContainer(toEnumValue<AlignmentContainer>(property.value<std::string>()));
-    } else if (property.name().ends_with("alignment-horizontal"s)) {
-        alignment->setHorizontal(toEnumValue<Alignment>(property.value<std::string>()));
-    } else if (property.name().ends_with("alignment-vertical"s)) {
-        alignment->setVertical(toEnumValue<Alignment>(property.value<std::string>()));
-    } else if (property.name().ends_with("alignment-order"s)) {
-        alignment->setOrder(property.value<int>(0));
+    alignment->setContainer(toEnumValue<AlignmentContainer>(property.value<std::string>(0)));
+    alignment->setHorizontal(toEnumValue<Alignment>(property.value<std::string>(1)));
+    alignment->setVertical(toEnumValue<Alignment>(property.value<std::string>(2)));
+    alignment->setOrder(property.value<int>(3));
+}
+
+// Calls function with the size group of the layout returned by getter, creating
+// the groups if needed.
+template<typename Getter, typename Setter, typename Function>
+inline void updateLayoutSize(StylePropertyGroup *output, Getter getter, Setter setter, Function &&function)
+{
+    PropertyGroupBuilder layout(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout);
+    PropertyGroupBuilder size(layout.instance, getter, setter);
+    function(size.instance);
+}
+
+inline void setSizeShorthand(SizePropertyGroup *output, const cssparser::Property &property)
+{
+    if (property.values().size() == 1) {
+        auto value = to_length(property.value());
+        output->setLeft(value);
+        output->setRight(value);
+        output->setTop(value);
+        output->setBottom(value);
+    } else if (property.values().size() == 2) {
+        auto horizontal = to_length(property.value(0));
+        auto vertical = to_length(property.value(1));
+        output->setLeft(horizontal);
+        output->setRight(horizontal);
+        output->setTop(vertical);
+        output->setBottom(vertical);
+    } else if (property.values().size() == 3) {
+        output->setTop(to_length(property.value(0)));
+        output->setRight(to_length(property.value(1)));
+        output->setBottom(to_length(property.value(2)));
+        output->setLeft(to_length(property.value(1)));
     } else if (property.values().size() == 4) {
-        alignment->setContainer(toEnumValue<AlignmentContainer>(property.value<std::string>(0)));
-        alignment->setHorizontal(toEnumValue<Alignment>(property.value<std::string>(1)));
-        alignment->setVertical(toEnumValue<Alignment>(property.value<std::string>(2)));
-        alignment->setOrder(property.value<int>(3));
+        output->setTop(to_length(property.value(0)));
+        output->setRight(to_length(property.value(1)));
+        output->setBottom(to_length(property.value(2)));
+        output->setLeft(to_length(property.value(3)));
     }
+}
+
+enum class Side {
+    Left = 1 << 0,
+    Right = 1 << 1,
+    Top = 1 << 2,
+    Bottom = 1 << 3,
+};
+Q_DECLARE_FLAGS(Sides, Side)
+Q_DECLARE_OPERATORS_FOR_FLAGS(Sides)
+
+static constexpr Sides AllSides = Sides{Side::Left, Side::Right, Side::Top, Side::Bottom};
+
+// Calls function with the line of each of sides of the group returned by
+// getter, creating the group and lines if needed.
+template<typename Getter, typename Setter, typename Function>
+inline void updateLines(StylePropertyGroup *output, Getter getter, Setter setter, Sides sides, Function &&function)
+{
+    PropertyGroupBuilder group(output, getter, setter);
+    using Group = typename decltype(group)::PropertyGroup;
 
-    if (tempAlignment && tempAlignment->hasAnyValue()) {
-        output->setAlignment(std::move(tempAlignment));
+    if (sides & Side::Left) {
+        function(PropertyGroupBuilder(group.instance, &Group::left, &Group::setLeft).instance);
+    }
+    if (sides & Side::Right) {
+        function(PropertyGroupBuilder(group.instance, &Group::right, &Group::setRight).instance);
+    }
+    if (sides & Side::Top) {
+        function(PropertyGroupBuilder(group.instance, &Group::top, &Group::setTop).instance);
+    }
+    if (sides & Side::Bottom) {
+        function(PropertyGroupBuilder(group.instance, &Group::bottom, &Group::setBottom).instance);
     }
 }
 
-inline void sizeFromProperty(SizePropertyGroup *output, const cssparser::Property &property)
+// Sets size, style and color of a line from a shorthand like "1px solid red".
+// A single keyword like "none" only sets the style and resets the others.
+inline void setLineShorthand(LinePropertyGroup *line, const cssparser::Property &property)
 {
-    if (property.name().ends_with("left")) {
-        output->setLeft(to_px(property.value()));
-    } else if (property.name().ends_with("right")) {
-        output->setRight(to_px(property.value()));
-    } else if (property.name().ends_with("top")) {
-        output->setTop(to_px(property.value()));
-    } else if (property.name().ends_with("bottom")) {
-        output->setBottom(to_px(property.value()));
-    } else {
-        if (property.values().size() == 1) {
-            auto value = to_px(property.value());
-            output->setLeft(value);
-            output->setRight(value);
-            output->setTop(value);
-            output->setBottom(value);
-        } else if (property.values().size() == 2) {
-            auto horizontal = to_px(property.value(0));
-            auto vertical = to_px(property.value(1));
-            output->setLeft(horizontal);
-            output->setRight(horizontal);
-            output->setTop(vertical);
-            output->setBottom(vertical);
-        } else if (property.values().size() == 3) {
-            output->setTop(to_px(property.value(0)));
-            output->setRight(to_px(property.value(1)));
-            output->setBottom(to_px(property.value(2)));
-            output->setLeft(to_px(property.value(1)));
-        } else if (property.values().size() == 4) {
-            output->setTop(to_px(property.value(0)));
-            output->setRight(to_px(property.value(1)));
-            output->setBottom(to_px(property.value(2)));
-            output->setLeft(to_px(property.value(3)));
-        }
+    if (property.values().size() == 1 && (property.value().type() == cssparser::Value::Type::String || matches_keyword(property.value(), u"none"_s))) {
+        line->setSize(to_length(cssparser::Value{}));
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+        line->setColor(to_color(cssparser::Value{}));
+        return;
     }
+
+    line->setSize(to_length(property.value(0)));
+    line->setStyle(toEnumValue<LineStyle>(property.value(1).get<std::string>()));
+    line->setColor(to_color(property.value(2)));
 }
 
-template<typename T>
-inline void setDirectionValue(T *output, const std::string &baseName, const cssparser::Property &property)
+// Calls function with the corner returned by getter, creating the corners
+// group and corner if needed.
+template<typename Getter, typename Setter>
+inline void setCornerRadius(StylePropertyGroup *output, Getter getter, Setter setter, Length radius)
 {
-    QList<QByteArray> directions;
-    QList<QByteArray> properties;
-    QList<cssparser::Value> values;
+    PropertyGroupBuilder corners(output, &StylePropertyGroup::corners, &StylePropertyGroup::setCorners);
+    PropertyGroupBuilder corner(corners.instance, getter, setter);
+    corner->setRadius(radius);
+}
 
-    auto parts = QByteArray(property.name()).split('-');
-    if (parts.isEmpty() || parts.first() != QByteArrayView(baseName)) {
-        qCDebug(UNION_CSS) << "Ignoring invalid property assignment of" << parts << "expected" << baseName;
-        return;
+// Images are sized in pixels of the image, so relative units do not apply.
+inline std::optional<qreal> to_image_pixels(const cssparser::Value &value)
+{
+    if (value.type() != cssparser::Value::Type::Dimension) {
+        return std::nullopt;
     }
 
-    if (parts.size() == 1) {
-        directions = {"left", "right", "top", "bottom"};
-        properties = {"width", "style", "color"};
+    auto dimension = value.get<cssparser::Dimension>();
+    if (dimension.unit() != cssparser::Dimension::Unit::Px) {
+        qCWarning(UNION_CSS) << "Image sizes and offsets should be specified in pixels";
+        return std::nullopt;
+    }
 
-        if (property.values().size() == 1 && property.value().type() == cssparser::Value::Type::String) {
-            values = {cssparser::Value{}, property.value(), cssparser::Value{}};
-        } else {
-            values = {property.value(0), property.value(1), property.value(2)};
-        }
-    } else if (parts.size() == 2) {
-        auto propertyName = parts.last();
-        if (propertyName == "width" || propertyName == "style" || propertyName == "color") {
-            directions = {"left", "right", "top", "bottom"};
-            properties = {propertyName};
-            values = {property.value()};
-        } else {
-            directions = {propertyName};
-            properties = {"width", "style", "color"};
-
-            if (property.values().size() == 1 && matches_keyword(property.value(), u"none"_s)) {
-                values = {cssparser::Value{}, property.value(), cssparser::Value{}};
-            } else {
-                values = {property.value(0), property.value(1), property.value(2)};
-            }
-        }
-    } else {
-        directions = {parts.at(1)};
-        properties = {parts.at(2)};
-        values = {property.value()};
-    }
-
-    auto setLineValue = [](auto &&line, const QByteArray &property, const cssparser::Value &value) {
-        if (property == "width" || property == "size") {
-            line->setSize(to_px(value));
-        } else if (property == "style") {
-            line->setStyle(toEnumValue<Union::Properties::LineStyle>(value.get<std::string>()));
-        } else if (property == "color") {
-            line->setColor(to_color(value));
-        }
-    };
+    return dimension.value();
+}
 
-    for (const auto &direction : std::as_const(directions)) {
-        for (qsizetype i = 0; i < properties.size(); ++i) {
-            auto property = properties.at(i);
-            auto value = values.at(i);
-            if (direction == "left") {
-                setLineValue(PropertyGroupBuilder(output, &T::left, &T::setLeft), property, value);
-            } else if (direction == "right") {
-                setLineValue(PropertyGroupBuilder(output, &T::right, &T::setRight), property, value);
-            } else if (direction == "top") {
-                setLineValue(PropertyGroupBuilder(output, &T::top, &T::setTop), property, value);
-            } else if (direction == "bottom") {
-                setLineValue(PropertyGroupBuilder(output, &T::bottom, &T::setBottom), property, value);
-            }
-        }
-    }
+template<typename Function>
+inline void updateBackgroundImage(StylePropertyGroup *output, Function &&function)
+{
+    PropertyGroupBuilder background(output, &StylePropertyGroup::background, &StylePropertyGroup::setBackground);
+    PropertyGroupBuilder image(background.instance, &BackgroundPropertyGroup::image, &BackgroundPropertyGroup::setImage);
+    function(image.instance);
+}
+
+template<typename Function>
+inline void updateFont(StylePropertyGroup *output, Function &&function)
+{
+    PropertyGroupBuilder text(output, &StylePropertyGroup::text, &StylePropertyGroup::setText);
+    auto font = text->font().value_or(QFont{});
+    function(font);
+    text->setFont(font);
 }
 
 bool CssLoader::load(Style::Ptr theme)
@@ -393,50 +429,166 @@ bool CssLoader::load(Style::Ptr theme)
         return false;
     }
 
-    cssparser::StyleSheet styleSheet(m_stylePath);
-
     auto defaultsPath =
         fs::path(QStandardPaths::locate(QStandardPaths::GenericDataLocation, u"union/css/defaults/default.css"_s, QStandardPaths::LocateFile).toStdString());
-    styleSheet.import(defaultsPath);
+
+    // Scoped custom properties and calc() are resolved before parsing, the
+    // parser only gets to see the processed files.
+    QTemporaryDir processedDir;
+    CssPreprocessor preprocessor(fs::path(processedDir.path().toStdString()));
+    preprocessor.addFile(defaultsPath);
+    preprocessor.addFile(m_stylePath);
+    if (!processedDir.isValid() || !preprocessor.process()) {
+        qCWarning(UNION_CSS) << "Could not write processed stylesheets for" << theme->name();
+        return false;
+    }
+
+    if (!preprocessor.errors().empty()) {
+        theme->setHasErrors(true);
+
+        qCWarning(UNION_CSS) << "Errors encountered while processing CSS:";
+        for (const auto &error : preprocessor.errors()) {
+            qCWarning(UNION_CSS) << "In file" << error.file.c_str() << "on line" << error.line << error.message.c_str();
+        }
+    }
+
+    // Parsing is not split up. The parser resolves imports, @property
+    // declarations and variables across all files in a single call, so only
+    // converting the parsed rules below is done concurrently.
+    cssparser::StyleSheet styleSheet(preprocessor.outputPath(m_stylePath));
+    styleSheet.import(preprocessor.outputPath(defaultsPath));
     styleSheet.parse();
 
     const auto paths = styleSheet.paths();
     for (const auto &path : paths) {
-        theme->addCachePath(path);
+        theme->addCachePath(preprocessor.sourcePath(path));
     }
 
     if (styleSheet.errors().size() > 0) {
         theme->setHasErrors(true);
 
         qCWarning(UNION_CSS) << "Errors encountered while parsing CSS:";
+        // The parser only sees the processed files, so report errors for the
+        // original files instead. Processing keeps lines where they are.
         for (const auto &error : styleSheet.errors()) {
-            qCWarning(UNION_CSS) << "In file" << error.file << "on line" << error.line << "column" << error.column << error.message.data();
+            const auto file = preprocessor.sourcePath(fs::path(error.file));
+            qCWarning(UNION_CSS) << "In file" << file.c_str() << "on line" << error.line << "column" << error.column << error.message.data();
+        }
+    }
+
+    const auto &rules = styleSheet.rules();
+
+    struct ConvertedRule {
+        SelectorList selectors;
+        StyleRule::Conditions conditions;
+        std::unique_ptr<StylePropertyGroup> properties;
+    };
+    std::vector<ConvertedRule> converted(rules.size());
+
+    auto convert = [this, &rules, &converted](std::size_t begin, std::size_t end) {
+        for (auto index = begin; index < end; ++index) {
+            const auto &rule = rules[index];
+            if (rule.properties().empty()) {
+                continue;
+            }
+
+            auto conditions = createConditions(rule.selector());
+            if (!conditions) {
+                continue;
+            }
+
+            converted[index].selectors = createSelectorList(rule.selector());
+            converted[index].conditions = conditions.value();
+            converted[index].properties = std::make_unique<StylePropertyGroup>();
+            createProperties(converted[index].properties.get(), rule.properties());
+        }
+    };
+
+    // Converting a parsed rule does not depend on any other rule, so split the
+    // rules into chunks and convert them concurrently. Each rule is written to
+    // its own slot so the original source order is preserved.
+    const auto threadCount = std::size_t(std::max(1, s_convertPool->maxThreadCount()));
+    const auto chunkSize = std::max(MinimumChunkSize, (rules.size() + threadCount) / (threadCount + 1));
+    const auto chunkCount = (rules.size() + chunkSize - 1) / chunkSize;
+
+    if (chunkCount > 1) {
+        std::latch done(std::ptrdiff_t(chunkCount - 1));
+        for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+            s_convertPool->start([&convert, &done, chunk, chunkSize, &rules]() {
+                convert(chunk * chunkSize, std::min(rules.size(), (chunk + 1) * chunkSize));
+                done.count_down();
+            });
         }
+        convert(0, chunkSize);
+        done.wait();
+    } else {
+        convert(0, rules.size());
     }
 
-    for (const auto &rule : styleSheet.rules()) {
-        if (rule.properties().empty()) {
+    for (auto &entry : converted) {
+        if (!entry.properties) {
             continue;
         }
 
         auto styleRule = StyleRule::create();
-        styleRule->setSelectors(createSelectorList(rule.selector()));
-
-        auto properties = std::make_unique<StylePropertyGroup>();
-        createProperties(properties.get(), rule.properties());
-        styleRule->setProperties(std::move(properties));
+        styleRule->setSelectors(entry.selectors);
+        styleRule->setConditions(entry.conditions);
+        styleRule->setProperties(std::move(entry.properties));
         theme->insert(styleRule);
     }
 
     return true;
 }
 
+static bool isConditionPart(const cssparser::SelectorPart &part)
+{
+    return part.kind() == cssparser::SelectorPart::Kind::PseudoClass && part.value().get<std::string>().starts_with(ConditionPrefix);
+}
+
 Union::SelectorList CssLoader::createSelectorList(const cssparser::Selector &selector)
 {
+    const auto &parts = selector.parts();
+    auto begin = parts.begin();
+
+    // Conditions only determine when a rule applies, so drop the compound
+    // selector on the document root that contains them along with the
+    // combinator that follows it.
+    if (std::ranges::any_of(parts, isConditionPart)) {
+        begin = std::ranges::find_if_not(parts, [](const auto &part) {
+            return isConditionPart(part) || part.kind() == cssparser::SelectorPart::Kind::DocumentRoot;
+        });
+        if (begin != parts.end()
+            && (begin->kind() == cssparser::SelectorPart::Kind::DescendantCombinator || begin->kind() == cssparser::SelectorPart::Kind::ChildCombinator)) {
+            ++begin;
+        }
+    }
+
     Union::SelectorList result;
-    std::ranges::transform(selector.parts(), std::back_inserter(result), [this](const auto &part) {
-        return createSelector(part);
-    });
+    for (auto itr = begin; itr != parts.end(); ++itr) {
+        if (!isConditionPart(*itr)) {
+            result.append(createSelector(*itr));
+        }
+    }
+    return result;
+}
+
+std::optional<StyleRule::Conditions> CssLoader::createConditions(const cssparser::Selector &selector)
+{
+    StyleRule::Conditions result;
+    for (const auto &part : selector.parts()) {
+        if (!isConditionPart(part)) {
+            continue;
+        }
+
+        const auto name = part.value().get<std::string>().substr(ConditionPrefix.size());
+        auto condition = enumFromKeyword<StyleRule::Condition>(name);
+        if (!condition) {
+            qCWarning(UNION_CSS) << "Ignoring rule with unknown condition" << QString::fromStdString(name);
+            return std::nullopt;
+        }
+
+        result |= condition.value();
+    }
     return result;
 }
 
@@ -455,7 +607,25 @@ Union::Selector CssLoader::createSelector(const cssparser::SelectorPart &part)
     case cssparser::SelectorPart::Kind::Id:
         return Union::Selector::create<Union::SelectorType::Id>(QString::fromStdString(part.value().get<std::string>()));
     case cssparser::SelectorPart::Kind::PseudoClass: {
-        auto value = toEnumIntValue<Union::Element::States>(part.value().get<std::string>());
+        const auto name = part.value().get<std::string>();
+        if (name == "first-child") {
+            return Union::Selector::create<Union::SelectorType::FirstChild>();
+        } else if (name == "last-child") {
+            return Union::Selector::create<Union::SelectorType::LastChild>();
+        } else if (name.starts_with("nth-child(") || name.starts_with("nth-last-child(")) {
+            const auto nth = parse_nth(pseudo_class_argument(name));
+            if (!nth) {
+                qCWarning(UNION_CSS) << "Ignoring invalid structural selector" << QString::fromStdString(name);
+                break;
+            }
+
+            if (name.starts_with("nth-child(")) {
+                return Union::Selector::create<Union::SelectorType::NthChild>(nth.value());
+            }
+            return Union::Selector::create<Union::SelectorType::NthLastChild>(nth.value());
+        }
+
+        auto value = toEnumIntValue<Union::Element::State>(name);
         return Union::Selector::create<Union::SelectorType::State>(Union::Element::State{value});
     }
     case cssparser::SelectorPart::Kind::Class:
@@ -463,21 +633,24 @@ Union::Selector CssLoader::createSelector(const cssparser::SelectorPart &part)
     case cssparser::SelectorPart::Kind::Attribute: {
         auto attributeMatch = part.attributeMatch().value();
         auto name = QString::fromStdString(attributeMatch.name());
+        // Operands of string matches are converted once here, so matching
+        // does not need to convert them for every element.
+        const auto operand = to_qvariant(attributeMatch.value()).toString();
         switch (attributeMatch.op()) {
         case cssparser::AttributeMatch::Operator::Exists:
             return Union::Selector::create<Union::SelectorType::AttributeExists>(name);
         case cssparser::AttributeMatch::Operator::Equals:
             return Union::Selector::create<Union::SelectorType::AttributeEquals>(std::make_pair(name, to_qvariant(attributeMatch.value())));
         case cssparser::AttributeMatch::Operator::Includes:
+            return Union::Selector::create<Union::SelectorType::AttributeIncludes>(std::make_pair(name, operand));
         case cssparser::AttributeMatch::Operator::Prefixed:
+            return Union::Selector::create<Union::SelectorType::AttributePrefixMatch>(std::make_pair(name, operand));
         case cssparser::AttributeMatch::Operator::Suffixed:
-            // TODO The above should technically not be substring matches
-        case cssparser::AttributeMatch::Operator::Substring: {
-            auto value = QString::fromStdString(attributeMatch.value().get<std::string>());
-            return Union::Selector::create<Union::SelectorType::AttributeSubstringMatch>(std::make_pair(name, value));
-        }
+            return Union::Selector::create<Union::SelectorType::AttributeSuffixMatch>(std::make_pair(name, operand));
+        case cssparser::AttributeMatch::Operator::Substring:
+            return Union::Selector::create<Union::SelectorType::AttributeSubstringMatch>(std::make_pair(name, operand));
         case cssparser::AttributeMatch::Operator::DashMatch:
-            // TODO
+            return Union::Selector::create<Union::SelectorType::AttributeDashMatch>(std::make_pair(name, operand));
         case cssparser::AttributeMatch::Operator::None:
             break;
         }
@@ -499,270 +672,817 @@ Union::Selector CssLoader::createSelector(const cssparser::SelectorPart &part)
 void CssLoader::createProperties(StylePropertyGroup *output, std::span<const cssparser::Property> properties)
 {
     for (const auto &property : properties) {
-        if (property.name() == "visibility"s || property.name() == "opacity"s) {
-            setDisplayProperty(output, property);
-        } else if (property.name() == "width"s || property.name() == "height"s || property.name() == "spacing"s) {
-            setLayoutProperty(output, property);
-        } else if (property.name().starts_with("padding")) {
-            setLayoutProperty(output, property);
-        } else if (property.name().starts_with("inset")) {
-            setLayoutProperty(output, property);
-        } else if (property.name().starts_with("margin")) {
-            setLayoutProperty(output, property);
-        } else if (property.name().starts_with("layout")) {
-            setLayoutProperty(output, property);
-        } else if (property.name().starts_with("background")) {
-            setBackgroundProperty(output, property);
-        } else if (property.name().starts_with("border")) {
-            setBorderProperty(output, property);
-        } else if (property.name().starts_with("outline")) {
-            setOutlineProperty(output, property);
-        } else if (property.name().starts_with("text") || property.name().starts_with("font")) {
-            setTextProperty(output, property);
-        } else if (property.name().starts_with("icon")) {
-            setIconProperty(output, property);
-        } else if (property.name() == "color"s) {
-            setTextProperty(output, property);
-            setIconProperty(output, property);
-        } else if (property.name().starts_with("shadow") || property.name().starts_with("box-shadow")) {
-            setShadowProperty(output, property);
+        const auto setter = findCssPropertySetter(property.name());
+        if (!setter) {
+            qCDebug(UNION_CSS) << "Ignoring unknown property" << QByteArrayView(property.name());
+            continue;
         }
+
+        setter(output, property, m_stylePath);
     }
 }
 
-void CssLoader::setDisplayProperty(StylePropertyGroup *output, const cssparser::Property &property)
+// The setters below are declared in the generated CssPropertyTable.h, each
+// CSS property has its own setter.
+
+using Layout = LayoutPropertyGroup;
+using Shadow = ShadowPropertyGroup;
+
+// Display
+
+void CssPropertySetters::visibility(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
     PropertyGroupBuilder display(output, &StylePropertyGroup::display, &StylePropertyGroup::setDisplay);
-
-    if (property.name() == "visibility") {
-        if (matches_keyword(property.value(), u"visible"_s)) {
-            display->setVisible(true);
-        } else if (matches_keyword(property.value(), u"hidden"_s)) {
-            display->setVisible(false);
-        }
+    if (matches_keyword(property.value(), u"visible"_s)) {
+        display->setVisible(true);
+    } else if (matches_keyword(property.value(), u"hidden"_s)) {
+        display->setVisible(false);
     }
+}
 
-    if (property.name() == "opacity") {
-        display->setOpacity(to_number(property.value()));
-    }
+void CssPropertySetters::opacity(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder display(output, &StylePropertyGroup::display, &StylePropertyGroup::setDisplay);
+    display->setOpacity(to_number(property.value()));
 }
 
-void CssLoader::setLayoutProperty(StylePropertyGroup *output, const cssparser::Property &property)
+// Layout
+
+void CssPropertySetters::width(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
     PropertyGroupBuilder layout(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout);
+    layout->setWidth(to_length(property.value()));
+}
 
-    if (property.name() == "width"s) {
-        layout->setWidth(to_px(property.value()));
-    } else if (property.name() == "height"s) {
-        layout->setHeight(to_px(property.value()));
-    } else if (property.name() == "spacing"s) {
-        layout->setSpacing(to_px(property.value()));
-    } else if (property.name().starts_with("layout-alignment")) {
-        setAlignment(layout.instance, property);
-    } else if (property.name().starts_with("padding")) {
-        PropertyGroupBuilder padding(layout.instance, &LayoutPropertyGroup::padding, &LayoutPropertyGroup::setPadding);
-        sizeFromProperty(padding.instance, property);
-    } else if (property.name().starts_with("inset")) {
-        PropertyGroupBuilder inset(layout.instance, &LayoutPropertyGroup::inset, &LayoutPropertyGroup::setInset);
-        sizeFromProperty(inset.instance, property);
-    } else if (property.name().starts_with("margin")) {
-        PropertyGroupBuilder margins(layout.instance, &LayoutPropertyGroup::margins, &LayoutPropertyGroup::setMargins);
-        sizeFromProperty(margins.instance, property);
-    }
+void CssPropertySetters::height(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder layout(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout);
+    layout->setHeight(to_length(property.value()));
 }
 
-void CssLoader::setBackgroundProperty(StylePropertyGroup *output, const cssparser::Property &property)
+void CssPropertySetters::spacing(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
-    PropertyGroupBuilder background(output, &StylePropertyGroup::background, &StylePropertyGroup::setBackground);
+    PropertyGroupBuilder layout(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout);
+    layout->setSpacing(to_length(property.value()));
+}
 
-    if (property.name() == "background"s) {
-        auto value = property.value();
-        if (matches_keyword(value, u"none"_s)) {
-            background->setColor(Union::Color{});
-            background->setImage(ImagePropertyGroup::empty());
-        } else if (value.type() == cssparser::Value::Type::Color) {
-            background->setColor(to_color(value));
-        } else if (value.type() == cssparser::Value::Type::Url) {
-            setImage(background.instance, m_stylePath, property);
-        }
-    }
+void CssPropertySetters::layoutAlignment(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout, [&](auto alignment) {
+        setAlignmentShorthand(alignment, property);
+    });
+}
 
-    if (property.name() == "background-color"s) {
-        background->setColor(to_color(property.value()));
-    }
+void CssPropertySetters::layoutAlignmentContainer(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout, [&](auto alignment) {
+        alignment->setContainer(toEnumValue<AlignmentContainer>(property.value<std::string>()));
+    });
+}
 
-    if (property.name() == "background-image") {
-        if (matches_keyword(property.value(), u"none"_s)) {
-            background->setImage(ImagePropertyGroup::empty());
-        } else {
-            setImage(background.instance, m_stylePath, property);
-        }
-    }
+void CssPropertySetters::layoutAlignmentHorizontal(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout, [&](auto alignment) {
+        alignment->setHorizontal(toEnumValue<Alignment>(property.value<std::string>()));
+    });
+}
 
-    if (property.name() == "background-image-mask-color") {
-        PropertyGroupBuilder image(background.instance, &BackgroundPropertyGroup::image, &BackgroundPropertyGroup::setImage);
-        image->setMaskColor(to_color(property.value()));
-    }
+void CssPropertySetters::layoutAlignmentVertical(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout, [&](auto alignment) {
+        alignment->setVertical(toEnumValue<Alignment>(property.value<std::string>()));
+    });
 }
 
-void CssLoader::setBorderProperty(StylePropertyGroup *output, const cssparser::Property &property)
+void CssPropertySetters::layoutAlignmentOrder(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
-    PropertyGroupBuilder border(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder);
+    updateAlignment(output, &StylePropertyGroup::layout, &StylePropertyGroup::setLayout, [&](auto alignment) {
+        alignment->setOrder(property.value<int>(0));
+    });
+}
 
-    if (property.name().ends_with("radius")) {
-        PropertyGroupBuilder corners(output, &StylePropertyGroup::corners, &StylePropertyGroup::setCorners);
+void CssPropertySetters::padding(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::padding, &Layout::setPadding, [&](auto size) {
+        setSizeShorthand(size, property);
+    });
+}
 
-        auto setCornerRadius = [](auto &&corner, qreal radius) {
-            corner->setRadius(radius);
-        };
+void CssPropertySetters::paddingLeft(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::padding, &Layout::setPadding, [&](auto size) {
+        size->setLeft(to_length(property.value()));
+    });
+}
 
-        if (property.name() == "border-radius"s) {
-            if (property.values().size() == 1) {
-                auto radius = to_px(property.value());
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::topLeft, &CornersPropertyGroup::setTopLeft), radius);
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::topRight, &CornersPropertyGroup::setTopRight), radius);
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::bottomLeft, &CornersPropertyGroup::setBottomLeft), radius);
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::bottomRight, &CornersPropertyGroup::setBottomRight), radius);
-            } else if (property.values().size() == 4) {
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::topLeft, &CornersPropertyGroup::setTopLeft),
-                                to_px(property.value(0)));
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::topRight, &CornersPropertyGroup::setTopRight),
-                                to_px(property.value(1)));
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::bottomRight, &CornersPropertyGroup::setBottomRight),
-                                to_px(property.value(2)));
-                setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::bottomLeft, &CornersPropertyGroup::setBottomLeft),
-                                to_px(property.value(3)));
-            }
-        } else if (property.name() == "border-top-left-radius") {
-            setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::topLeft, &CornersPropertyGroup::setTopLeft), to_px(property.value()));
-        } else if (property.name() == "border-top-right-radius") {
-            setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::topRight, &CornersPropertyGroup::setTopRight),
-                            to_px(property.value()));
-        } else if (property.name() == "border-bottom-left-radius") {
-            setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::bottomLeft, &CornersPropertyGroup::setBottomLeft),
-                            to_px(property.value()));
-        } else if (property.name() == "border-bottom-right-radius") {
-            setCornerRadius(PropertyGroupBuilder(corners.instance, &CornersPropertyGroup::bottomRight, &CornersPropertyGroup::setBottomRight),
-                            to_px(property.value()));
-        }
+void CssPropertySetters::paddingRight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::padding, &Layout::setPadding, [&](auto size) {
+        size->setRight(to_length(property.value()));
+    });
+}
 
-        return;
-    }
+void CssPropertySetters::paddingTop(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::padding, &Layout::setPadding, [&](auto size) {
+        size->setTop(to_length(property.value()));
+    });
+}
 
-    setDirectionValue(border.instance, "border"s, property);
+void CssPropertySetters::paddingBottom(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::padding, &Layout::setPadding, [&](auto size) {
+        size->setBottom(to_length(property.value()));
+    });
 }
 
-void CssLoader::setOutlineProperty(StylePropertyGroup *output, const cssparser::Property &property)
+void CssPropertySetters::inset(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
-    PropertyGroupBuilder outline(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline);
-    setDirectionValue(outline.instance, "outline"s, property);
+    updateLayoutSize(output, &Layout::inset, &Layout::setInset, [&](auto size) {
+        setSizeShorthand(size, property);
+    });
 }
 
-void CssLoader::setTextProperty(StylePropertyGroup *output, const cssparser::Property &property)
+void CssPropertySetters::insetLeft(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
-    PropertyGroupBuilder text(output, &StylePropertyGroup::text, &StylePropertyGroup::setText);
+    updateLayoutSize(output, &Layout::inset, &Layout::setInset, [&](auto size) {
+        size->setLeft(to_length(property.value()));
+    });
+}
 
-    if (property.name().starts_with("text-alignment")) {
-        setAlignment(text.instance, property);
-    }
+void CssPropertySetters::insetRight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::inset, &Layout::setInset, [&](auto size) {
+        size->setRight(to_length(property.value()));
+    });
+}
 
-    if (property.name().starts_with("font")) {
-        auto font = text->font().value_or(QFont{});
+void CssPropertySetters::insetTop(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::inset, &Layout::setInset, [&](auto size) {
+        size->setTop(to_length(property.value()));
+    });
+}
 
-        if (property.name() == "font-family") {
-            font.setFamily(QString::fromStdString(property.value<std::string>()));
-        } else if (property.name() == "font-size") {
-            auto dimension = property.value<cssparser::Dimension>();
-            switch (dimension.unit()) {
-            case cssparser::Dimension::Unit::Px:
-                font.setPixelSize(int(dimension.value()));
-                break;
-            case cssparser::Dimension::Unit::Pt:
-                font.setPointSizeF(dimension.value());
-                break;
-            case cssparser::Dimension::Unit::Percent:
-                font.setPointSizeF(font.pointSizeF() * dimension.value());
-                break;
-            default:
-                qCWarning(UNION_CSS) << "Invalid unit for font-size";
-                break;
-            }
-        } else if (property.name() == "font-weight") {
-            if (property.value().type() == cssparser::Value::Type::Integer) {
-                font.setWeight(QFont::Weight(property.value<int>()));
-            } else {
-                auto name = property.value<std::string>();
-                if (name == "normal") {
-                    font.setWeight(QFont::Weight::Normal);
-                } else if (name == "bold") {
-                    font.setWeight(QFont::Weight::Bold);
-                } else if (name == "bolder") {
-                    font.setWeight(QFont::Weight(font.weight() + 100));
-                } else if (name == "lighter") {
-                    font.setWeight(QFont::Weight(font.weight() - 100));
-                }
-            }
-        }
+void CssPropertySetters::insetBottom(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::inset, &Layout::setInset, [&](auto size) {
+        size->setBottom(to_length(property.value()));
+    });
+}
 
-        text->setFont(font);
-    }
+void CssPropertySetters::margin(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::margins, &Layout::setMargins, [&](auto size) {
+        setSizeShorthand(size, property);
+    });
+}
 
-    if (property.name() == "color" || property.name() == "text-color") {
-        text->setColor(to_color(property.value()));
-    }
+void CssPropertySetters::marginLeft(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::margins, &Layout::setMargins, [&](auto size) {
+        size->setLeft(to_length(property.value()));
+    });
+}
 
-    if (property.name() == "text-wrap-mode") {
-        const auto val = property.value<std::string>();
-        // Wrap is shorthand for WrapAtWordBoundaryOrAnywhere
-        if (val == "wrap") {
-            text->setWrapMode(TextWrapMode::WrapAtWordBoundaryOrAnywhere);
-        } else {
-            text->setWrapMode(toEnumValue<TextWrapMode>(property.value<std::string>()));
-        }
-    }
+void CssPropertySetters::marginRight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::margins, &Layout::setMargins, [&](auto size) {
+        size->setRight(to_length(property.value()));
+    });
+}
 
-    if (property.name() == "text-elide") {
-        text->setElide(toEnumValue<TextElide>(property.value<std::string>()));
-    }
+void CssPropertySetters::marginTop(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::margins, &Layout::setMargins, [&](auto size) {
+        size->setTop(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::marginBottom(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLayoutSize(output, &Layout::margins, &Layout::setMargins, [&](auto size) {
+        size->setBottom(to_length(property.value()));
+    });
 }
 
-void CssLoader::setIconProperty(StylePropertyGroup *output, const cssparser::Property &property)
+// Text
+
+void CssPropertySetters::color(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
+    // Like web CSS, color applies to both text and icons.
+    const auto color = to_color(property.value());
+
+    PropertyGroupBuilder text(output, &StylePropertyGroup::text, &StylePropertyGroup::setText);
+    text->setColor(color);
+
     PropertyGroupBuilder icon(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon);
+    icon->setColor(color);
+}
 
-    if (property.name().starts_with("icon-alignment")) {
-        setAlignment(icon.instance, property);
-    }
+void CssPropertySetters::textColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder text(output, &StylePropertyGroup::text, &StylePropertyGroup::setText);
+    text->setColor(to_color(property.value()));
+}
 
-    if (property.name() == "icon-name") {
-        icon->setName(QString::fromStdString(property.value<std::string>()));
-    } else if (property.name() == "icon-width") {
-        icon->setWidth(to_px(property.value()));
-    } else if (property.name() == "icon-height") {
-        icon->setHeight(to_px(property.value()));
-    } else if (property.name() == "icon-size") {
-        icon->setWidth(to_px(property.value()));
-        icon->setHeight(to_px(property.value()));
-    } else if (property.name() == "color" || property.name() == "icon-color") {
-        icon->setColor(to_color(property.value()));
-    }
+void CssPropertySetters::fontFamily(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateFont(output, [&](QFont &font) {
+        font.setFamily(QString::fromStdString(property.value<std::string>()));
+    });
 }
 
-void CssLoader::setShadowProperty(StylePropertyGroup *output, const cssparser::Property &property)
+void CssPropertySetters::fontSize(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
 {
-    if (property.name() == "box-shadow") {
-        if (matches_keyword(property.value(), u"none"_s)) {
-            output->setShadow(ShadowPropertyGroup::empty());
-        } else {
-            PropertyGroupBuilder shadow(output, &StylePropertyGroup::shadow, &StylePropertyGroup::setShadow);
+    updateFont(output, [&](QFont &font) {
+        auto dimension = property.value<cssparser::Dimension>();
+        switch (dimension.unit()) {
+        case cssparser::Dimension::Unit::Px:
+            font.setPixelSize(int(dimension.value()));
+            break;
+        case cssparser::Dimension::Unit::Pt:
+            font.setPointSizeF(dimension.value());
+            break;
+        case cssparser::Dimension::Unit::Percent:
+            font.setPointSizeF(font.pointSizeF() * dimension.value());
+            break;
+        default:
+            qCWarning(UNION_CSS) << "Invalid unit for font-size";
+            break;
+        }
+    });
+}
 
-            PropertyGroupBuilder offset(shadow.instance, &ShadowPropertyGroup::offset, &ShadowPropertyGroup::setOffset);
-            offset->setHorizontal(to_px(property.value(0)));
-            offset->setVertical(to_px(property.value(1)));
+void CssPropertySetters::fontWeight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateFont(output, [&](QFont &font) {
+        if (property.value().type() == cssparser::Value::Type::Integer) {
+            font.setWeight(QFont::Weight(property.value<int>()));
+            return;
+        }
 
-            shadow->setBlur(to_px(property.value(2)));
-            shadow->setSize(to_px(property.value(3)));
-            shadow->setColor(to_color(property.value(4)));
+        auto name = property.value<std::string>();
+        if (name == "normal") {
+            font.setWeight(QFont::Weight::Normal);
+        } else if (name == "bold") {
+            font.setWeight(QFont::Weight::Bold);
+        } else if (name == "bolder") {
+            font.setWeight(QFont::Weight(font.weight() + 100));
+        } else if (name == "lighter") {
+            font.setWeight(QFont::Weight(font.weight() - 100));
         }
+    });
+}
+
+void CssPropertySetters::textWrapMode(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder text(output, &StylePropertyGroup::text, &StylePropertyGroup::setText);
+    const auto value = property.value<std::string>();
+    // Wrap is shorthand for WrapAtWordBoundaryOrAnywhere
+    if (value == "wrap") {
+        text->setWrapMode(TextWrapMode::WrapAtWordBoundaryOrAnywhere);
+    } else {
+        text->setWrapMode(toEnumValue<TextWrapMode>(value));
     }
 }
+
+void CssPropertySetters::textElide(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder text(output, &StylePropertyGroup::text, &StylePropertyGroup::setText);
+    text->setElide(toEnumValue<TextElide>(property.value<std::string>()));
+}
+
+void CssPropertySetters::textAlignment(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::text, &StylePropertyGroup::setText, [&](auto alignment) {
+        setAlignmentShorthand(alignment, property);
+    });
+}
+
+void CssPropertySetters::textAlignmentContainer(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::text, &StylePropertyGroup::setText, [&](auto alignment) {
+        alignment->setContainer(toEnumValue<AlignmentContainer>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::textAlignmentHorizontal(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::text, &StylePropertyGroup::setText, [&](auto alignment) {
+        alignment->setHorizontal(toEnumValue<Alignment>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::textAlignmentVertical(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::text, &StylePropertyGroup::setText, [&](auto alignment) {
+        alignment->setVertical(toEnumValue<Alignment>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::textAlignmentOrder(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::text, &StylePropertyGroup::setText, [&](auto alignment) {
+        alignment->setOrder(property.value<int>(0));
+    });
+}
+
+// Icon
+
+void CssPropertySetters::iconName(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder icon(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon);
+    icon->setName(QString::fromStdString(property.value<std::string>()));
+}
+
+void CssPropertySetters::iconSource(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &stylePath)
+{
+    const auto path = stylePath / to_path(property.value());
+    if (!fs::exists(path)) {
+        qCWarning(UNION_CSS) << "Could not load icon" << path.string();
+        return;
+    }
+
+    PropertyGroupBuilder icon(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon);
+    icon->setSource(QUrl::fromLocalFile(QString::fromStdString(path.string())));
+}
+
+void CssPropertySetters::iconWidth(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder icon(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon);
+    icon->setWidth(to_length(property.value()));
+}
+
+void CssPropertySetters::iconHeight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder icon(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon);
+    icon->setHeight(to_length(property.value()));
+}
+
+void CssPropertySetters::iconSize(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder icon(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon);
+    icon->setWidth(to_length(property.value()));
+    icon->setHeight(to_length(property.value()));
+}
+
+void CssPropertySetters::iconColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder icon(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon);
+    icon->setColor(to_color(property.value()));
+}
+
+void CssPropertySetters::iconAlignment(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon, [&](auto alignment) {
+        setAlignmentShorthand(alignment, property);
+    });
+}
+
+void CssPropertySetters::iconAlignmentContainer(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon, [&](auto alignment) {
+        alignment->setContainer(toEnumValue<AlignmentContainer>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::iconAlignmentHorizontal(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon, [&](auto alignment) {
+        alignment->setHorizontal(toEnumValue<Alignment>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::iconAlignmentVertical(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon, [&](auto alignment) {
+        alignment->setVertical(toEnumValue<Alignment>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::iconAlignmentOrder(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateAlignment(output, &StylePropertyGroup::icon, &StylePropertyGroup::setIcon, [&](auto alignment) {
+        alignment->setOrder(property.value<int>(0));
+    });
+}
+
+// Background
+
+void CssPropertySetters::background(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &stylePath)
+{
+    PropertyGroupBuilder background(output, &StylePropertyGroup::background, &StylePropertyGroup::setBackground);
+
+    auto value = property.value();
+    if (matches_keyword(value, u"none"_s)) {
+        background->setColor(Union::Color{});
+        background->setImage(ImagePropertyGroup::empty());
+    } else if (value.type() == cssparser::Value::Type::Color) {
+        background->setColor(to_color(value));
+    } else if (value.type() == cssparser::Value::Type::Url) {
+        setImage(background.instance, stylePath, property);
+    }
+}
+
+void CssPropertySetters::backgroundColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder background(output, &StylePropertyGroup::background, &StylePropertyGroup::setBackground);
+    background->setColor(to_color(property.value()));
+}
+
+void CssPropertySetters::backgroundImage(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &stylePath)
+{
+    PropertyGroupBuilder background(output, &StylePropertyGroup::background, &StylePropertyGroup::setBackground);
+    if (matches_keyword(property.value(), u"none"_s)) {
+        background->setImage(ImagePropertyGroup::empty());
+    } else {
+        setImage(background.instance, stylePath, property);
+    }
+}
+
+void CssPropertySetters::backgroundImageMaskColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateBackgroundImage(output, [&](auto image) {
+        image->setMaskColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::backgroundImageWidth(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateBackgroundImage(output, [&](auto image) {
+        image->setWidth(to_image_pixels(property.value()));
+    });
+}
+
+void CssPropertySetters::backgroundImageHeight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateBackgroundImage(output, [&](auto image) {
+        image->setHeight(to_image_pixels(property.value()));
+    });
+}
+
+void CssPropertySetters::backgroundImageXOffset(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateBackgroundImage(output, [&](auto image) {
+        image->setXOffset(to_image_pixels(property.value()));
+    });
+}
+
+void CssPropertySetters::backgroundImageYOffset(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateBackgroundImage(output, [&](auto image) {
+        image->setYOffset(to_image_pixels(property.value()));
+    });
+}
+
+// Border
+
+void CssPropertySetters::border(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, AllSides, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::borderWidth(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, AllSides, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::borderStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, AllSides, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::borderColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, AllSides, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::borderLeft(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Left, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::borderLeftWidth(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Left, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::borderLeftStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Left, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::borderLeftColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Left, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::borderRight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Right, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::borderRightWidth(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Right, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::borderRightStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Right, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::borderRightColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Right, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::borderTop(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Top, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::borderTopWidth(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Top, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::borderTopStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Top, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::borderTopColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Top, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::borderBottom(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Bottom, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::borderBottomWidth(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Bottom, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::borderBottomStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Bottom, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::borderBottomColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::border, &StylePropertyGroup::setBorder, Side::Bottom, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::borderRadius(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    if (property.values().size() == 1) {
+        auto radius = to_length(property.value());
+        setCornerRadius(output, &CornersPropertyGroup::topLeft, &CornersPropertyGroup::setTopLeft, radius);
+        setCornerRadius(output, &CornersPropertyGroup::topRight, &CornersPropertyGroup::setTopRight, radius);
+        setCornerRadius(output, &CornersPropertyGroup::bottomLeft, &CornersPropertyGroup::setBottomLeft, radius);
+        setCornerRadius(output, &CornersPropertyGroup::bottomRight, &CornersPropertyGroup::setBottomRight, radius);
+    } else if (property.values().size() == 4) {
+        setCornerRadius(output, &CornersPropertyGroup::topLeft, &CornersPropertyGroup::setTopLeft, to_length(property.value(0)));
+        setCornerRadius(output, &CornersPropertyGroup::topRight, &CornersPropertyGroup::setTopRight, to_length(property.value(1)));
+        setCornerRadius(output, &CornersPropertyGroup::bottomRight, &CornersPropertyGroup::setBottomRight, to_length(property.value(2)));
+        setCornerRadius(output, &CornersPropertyGroup::bottomLeft, &CornersPropertyGroup::setBottomLeft, to_length(property.value(3)));
+    }
+}
+
+void CssPropertySetters::borderTopLeftRadius(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    setCornerRadius(output, &CornersPropertyGroup::topLeft, &CornersPropertyGroup::setTopLeft, to_length(property.value()));
+}
+
+void CssPropertySetters::borderTopRightRadius(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    setCornerRadius(output, &CornersPropertyGroup::topRight, &CornersPropertyGroup::setTopRight, to_length(property.value()));
+}
+
+void CssPropertySetters::borderBottomLeftRadius(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    setCornerRadius(output, &CornersPropertyGroup::bottomLeft, &CornersPropertyGroup::setBottomLeft, to_length(property.value()));
+}
+
+void CssPropertySetters::borderBottomRightRadius(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    setCornerRadius(output, &CornersPropertyGroup::bottomRight, &CornersPropertyGroup::setBottomRight, to_length(property.value()));
+}
+
+// Outline
+
+void CssPropertySetters::outline(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, AllSides, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::outlineLeft(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Left, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::outlineLeftSize(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Left, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::outlineLeftStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Left, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::outlineLeftColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Left, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::outlineRight(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Right, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::outlineRightSize(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Right, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::outlineRightStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Right, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::outlineRightColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Right, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::outlineTop(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Top, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::outlineTopSize(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Top, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::outlineTopStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Top, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::outlineTopColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Top, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+void CssPropertySetters::outlineBottom(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Bottom, [&](auto line) {
+        setLineShorthand(line, property);
+    });
+}
+
+void CssPropertySetters::outlineBottomSize(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Bottom, [&](auto line) {
+        line->setSize(to_length(property.value()));
+    });
+}
+
+void CssPropertySetters::outlineBottomStyle(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Bottom, [&](auto line) {
+        line->setStyle(toEnumValue<LineStyle>(property.value<std::string>()));
+    });
+}
+
+void CssPropertySetters::outlineBottomColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    updateLines(output, &StylePropertyGroup::outline, &StylePropertyGroup::setOutline, Side::Bottom, [&](auto line) {
+        line->setColor(to_color(property.value()));
+    });
+}
+
+// Shadow
+
+void CssPropertySetters::boxShadow(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    if (matches_keyword(property.value(), u"none"_s)) {
+        output->setShadow(ShadowPropertyGroup::empty());
+        return;
+    }
+
+    PropertyGroupBuilder shadow(output, &StylePropertyGroup::shadow, &StylePropertyGroup::setShadow);
+
+    PropertyGroupBuilder offset(shadow.instance, &Shadow::offset, &Shadow::setOffset);
+    offset->setHorizontal(to_length(property.value(0)));
+    offset->setVertical(to_length(property.value(1)));
+
+    shadow->setBlur(to_length(property.value(2)));
+    shadow->setSize(to_length(property.value(3)));
+    shadow->setColor(to_color(property.value(4)));
+}
+
+void CssPropertySetters::shadowOffsetHorizontal(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder shadow(output, &StylePropertyGroup::shadow, &StylePropertyGroup::setShadow);
+    PropertyGroupBuilder offset(shadow.instance, &Shadow::offset, &Shadow::setOffset);
+    offset->setHorizontal(to_length(property.value()));
+}
+
+void CssPropertySetters::shadowOffsetVertical(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder shadow(output, &StylePropertyGroup::shadow, &StylePropertyGroup::setShadow);
+    PropertyGroupBuilder offset(shadow.instance, &Shadow::offset, &Shadow::setOffset);
+    offset->setVertical(to_length(property.value()));
+}
+
+void CssPropertySetters::shadowBlur(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder shadow(output, &StylePropertyGroup::shadow, &StylePropertyGroup::setShadow);
+    shadow->setBlur(to_length(property.value()));
+}
+
+void CssPropertySetters::shadowSize(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder shadow(output, &StylePropertyGroup::shadow, &StylePropertyGroup::setShadow);
+    shadow->setSize(to_length(property.value()));
+}
+
+void CssPropertySetters::shadowColor(StylePropertyGroup *output, const cssparser::Property &property, const fs::path &)
+{
+    PropertyGroupBuilder shadow(output, &StylePropertyGroup::shadow, &StylePropertyGroup::setShadow);
+    shadow->setColor(to_color(property.value()));
+}
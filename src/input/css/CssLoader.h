@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 
 #include <Selector.h>
 #include <StyleRule.h>
@@ -27,18 +28,10 @@ public:
 
 private:
     SelectorList createSelectorList(const cssparser::Selector &selector);
+    std::optional<StyleRule::Conditions> createConditions(const cssparser::Selector &selector);
     Selector createSelector(const cssparser::SelectorPart &part);
 
     void createProperties(StylePropertyGroup *output, std::span<const cssparser::Property> properties);
 
-    void setDisplayProperty(StylePropertyGroup *output, const cssparser::Property &property);
-    void setLayoutProperty(StylePropertyGroup *output, const cssparser::Property &property);
-    void setBackgroundProperty(StylePropertyGroup *output, const cssparser::Property &property);
-    void setBorderProperty(StylePropertyGroup *output, const cssparser::Property &property);
-    void setOutlineProperty(StylePropertyGroup *output, const cssparser::Property &property);
-    void setTextProperty(StylePropertyGroup *output, const cssparser::Property &property);
-    void setIconProperty(StylePropertyGroup *output, const cssparser::Property &property);
-    void setShadowProperty(StylePropertyGroup *output, const cssparser::Property &property);
-
     std::filesystem::path m_stylePath;
 };
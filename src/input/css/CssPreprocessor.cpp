@@ -0,0 +1,846 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "CssPreprocessor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+static constexpr std::size_t npos = std::string::npos;
+
+static bool isIdentifierCharacter(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_';
+}
+
+static bool isWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static std::string trimmed(std::string_view value)
+{
+    while (!value.empty() && isWhitespace(value.front())) {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && isWhitespace(value.back())) {
+        value.remove_suffix(1);
+    }
+    return std::string(value);
+}
+
+// Returns the position after the string or comment starting at position, or
+// position if there is none.
+static std::size_t skipStringOrComment(std::string_view text, std::size_t position)
+{
+    const auto c = text[position];
+    if (c == '"' || c == '\'') {
+        for (auto index = position + 1; index < text.size(); ++index) {
+            if (text[index] == '\\') {
+                ++index;
+            } else if (text[index] == c) {
+                return index + 1;
+            }
+        }
+        return text.size();
+    }
+
+    if (c == '/' && position + 1 < text.size() && text[position + 1] == '*') {
+        const auto end = text.find("*/", position + 2);
+        return end == npos ? text.size() : end + 2;
+    }
+
+    return position;
+}
+
+// Returns the position of the parenthesis closing the one at open.
+static std::size_t findClosing(std::string_view text, std::size_t open)
+{
+    int depth = 0;
+    for (auto index = open; index < text.size();) {
+        const auto skipped = skipStringOrComment(text, index);
+        if (skipped != index) {
+            index = skipped;
+            continue;
+        }
+
+        if (text[index] == '(') {
+            ++depth;
+        } else if (text[index] == ')') {
+            if (--depth == 0) {
+                return index;
+            }
+        }
+        ++index;
+    }
+    return npos;
+}
+
+// Returns the position of a call to the function name, ignoring strings.
+static std::size_t findFunction(std::string_view text, std::string_view name, std::size_t from)
+{
+    for (auto index = from; index < text.size();) {
+        const auto skipped = skipStringOrComment(text, index);
+        if (skipped != index) {
+            index = skipped;
+            continue;
+        }
+
+        if (text.substr(index).starts_with(name) && index + name.size() < text.size() && text[index + name.size()] == '('
+            && (index == 0 || !isIdentifierCharacter(text[index - 1]))) {
+            return index;
+        }
+        ++index;
+    }
+    return npos;
+}
+
+static std::string stripComments(std::string_view text)
+{
+    std::string result;
+    for (std::size_t index = 0; index < text.size();) {
+        const auto skipped = skipStringOrComment(text, index);
+        if (skipped != index) {
+            if (text[index] == '/') {
+                result += ' ';
+            } else {
+                result += text.substr(index, skipped - index);
+            }
+            index = skipped;
+            continue;
+        }
+        result += text[index++];
+    }
+    return result;
+}
+
+// Splits text at separator, ignoring separators inside parentheses, brackets
+// and strings.
+static std::vector<std::string> splitTopLevel(std::string_view text, char separator, std::size_t maxParts = npos)
+{
+    std::vector<std::string> result;
+    int depth = 0;
+    std::size_t start = 0;
+    for (std::size_t index = 0; index < text.size();) {
+        const auto skipped = skipStringOrComment(text, index);
+        if (skipped != index) {
+            index = skipped;
+            continue;
+        }
+
+        const auto c = text[index];
+        if (c == '(' || c == '[') {
+            ++depth;
+        } else if (c == ')' || c == ']') {
+            --depth;
+        } else if (c == separator && depth == 0 && result.size() + 1 < maxParts) {
+            result.push_back(trimmed(text.substr(start, index - start)));
+            start = index + 1;
+        }
+        ++index;
+    }
+    result.push_back(trimmed(text.substr(start)));
+    return result;
+}
+
+// Returns the newlines in the given range, so replacing it keeps the line
+// numbers reported by the parser intact.
+static std::string blankRange(std::string_view text, std::size_t begin, std::size_t end)
+{
+    return std::string(std::count(text.begin() + begin, text.begin() + end, '\n'), '\n');
+}
+
+// Normalizes whitespace in a selector so selectors can be compared as strings.
+static std::string normalizeSelector(std::string_view selector)
+{
+    std::string result;
+    bool pendingSpace = false;
+    int depth = 0;
+    for (std::size_t index = 0; index < selector.size();) {
+        const auto skipped = skipStringOrComment(selector, index);
+        if (skipped != index) {
+            if (pendingSpace && !result.empty()) {
+                result += ' ';
+            }
+            pendingSpace = false;
+            result += selector.substr(index, skipped - index);
+            index = skipped;
+            continue;
+        }
+
+        const auto c = selector[index++];
+        if (isWhitespace(c)) {
+            pendingSpace = true;
+            continue;
+        }
+
+        if (depth == 0 && (c == '>' || c == '+' || c == '~')) {
+            while (!result.empty() && result.back() == ' ') {
+                result.pop_back();
+            }
+            if (!result.empty()) {
+                result += ' ';
+            }
+            result += c;
+            pendingSpace = true;
+            continue;
+        }
+
+        if (c == '(' || c == '[') {
+            ++depth;
+        } else if (c == ')' || c == ']') {
+            --depth;
+        }
+
+        if (pendingSpace && !result.empty()) {
+            result += ' ';
+        }
+        pendingSpace = false;
+        result += c;
+    }
+    return result;
+}
+
+// Combines a nested selector with the selector of its parent rule.
+static std::string nestSelector(const std::string &parent, const std::string &selector)
+{
+    if (selector.find('&') == npos) {
+        return normalizeSelector(parent + " " + selector);
+    }
+
+    std::string result;
+    for (auto c : selector) {
+        if (c == '&') {
+            result += parent;
+        } else {
+            result += c;
+        }
+    }
+    return normalizeSelector(result);
+}
+
+struct Compound {
+    std::string combinator;
+    std::string selector;
+};
+
+static std::vector<Compound> compounds(const std::string &selector)
+{
+    std::vector<Compound> result;
+    std::string combinator = " ";
+    for (const auto &part : splitTopLevel(selector, ' ')) {
+        if (part == ">" || part == "+" || part == "~") {
+            combinator = part;
+            continue;
+        }
+        result.push_back(Compound{.combinator = combinator, .selector = part});
+        combinator = " ";
+    }
+    return result;
+}
+
+// A compound selector like "button:hover" refines "button", as every element
+// it matches is also matched by "button".
+static bool refines(const std::string &compound, const std::string &scope)
+{
+    if (scope == "*") {
+        return true;
+    }
+
+    return compound.starts_with(scope) && (compound.size() == scope.size() || !isIdentifierCharacter(compound[scope.size()]));
+}
+
+// Matches the selector a custom property was declared on against the selector
+// of the rule using it. Returns how close to the subject the scope matches and
+// how specific it is, or std::nullopt if it does not apply.
+static std::optional<std::pair<std::size_t, std::size_t>> matchScope(const std::vector<Compound> &scope, const std::vector<Compound> &selector)
+{
+    if (scope.empty() || scope.size() > selector.size()) {
+        return std::nullopt;
+    }
+
+    std::optional<std::pair<std::size_t, std::size_t>> result;
+    for (std::size_t offset = 0; offset + scope.size() <= selector.size(); ++offset) {
+        bool matches = true;
+        std::size_t specificity = 0;
+        for (std::size_t index = 0; index < scope.size() && matches; ++index) {
+            const auto &part = selector[offset + index];
+            matches = refines(part.selector, scope[index].selector) && (index == 0 || part.combinator == scope[index].combinator);
+            specificity += scope[index].selector.size();
+        }
+
+        if (matches) {
+            result = std::make_pair(offset + scope.size(), specificity);
+        }
+    }
+    return result;
+}
+
+struct Quantity {
+    double value = 0.0;
+    std::string unit;
+};
+
+class CalcParser
+{
+public:
+    explicit CalcParser(std::string_view text)
+        : m_text(text)
+    {
+    }
+
+    std::optional<Quantity> parse()
+    {
+        auto result = expression();
+        skipWhitespace();
+        if (!result || m_position != m_text.size()) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+private:
+    std::optional<Quantity> expression()
+    {
+        auto result = term();
+        while (result) {
+            const auto start = m_position;
+            skipWhitespace();
+            if (m_position >= m_text.size() || (m_text[m_position] != '+' && m_text[m_position] != '-')) {
+                m_position = start;
+                break;
+            }
+
+            const auto op = m_text[m_position++];
+            auto other = term();
+            if (!other || other->unit != result->unit) {
+                return std::nullopt;
+            }
+
+            result->value += op == '+' ? other->value : -other->value;
+        }
+        return result;
+    }
+
+    std::optional<Quantity> term()
+    {
+        auto result = factor();
+        while (result) {
+            const auto start = m_position;
+            skipWhitespace();
+            if (m_position >= m_text.size() || (m_text[m_position] != '*' && m_text[m_position] != '/')) {
+                m_position = start;
+                break;
+            }
+
+            const auto op = m_text[m_position++];
+            auto other = factor();
+            if (!other) {
+                return std::nullopt;
+            }
+
+            if (op == '*') {
+                if (!result->unit.empty() && !other->unit.empty()) {
+                    return std::nullopt;
+                }
+                result->value *= other->value;
+                result->unit = result->unit.empty() ? other->unit : result->unit;
+            } else {
+                if (other->value == 0.0 || (!other->unit.empty() && other->unit != result->unit)) {
+                    return std::nullopt;
+                }
+                result->value /= other->value;
+                result->unit = other->unit.empty() ? result->unit : std::string{};
+            }
+        }
+        return result;
+    }
+
+    std::optional<Quantity> factor()
+    {
+        skipWhitespace();
+        if (m_position >= m_text.size()) {
+            return std::nullopt;
+        }
+
+        const auto remaining = m_text.substr(m_position);
+        if (remaining.starts_with("calc(") || remaining.starts_with("(")) {
+            m_position += remaining.front() == '(' ? 1 : 5;
+            auto result = expression();
+            skipWhitespace();
+            if (!result || m_position >= m_text.size() || m_text[m_position] != ')') {
+                return std::nullopt;
+            }
+            ++m_position;
+            return result;
+        }
+
+        if (remaining.starts_with("-(") || remaining.starts_with("-calc(")) {
+            ++m_position;
+            auto result = factor();
+            if (result) {
+                result->value = -result->value;
+            }
+            return result;
+        }
+
+        if (remaining.front() == '+') {
+            ++m_position;
+        }
+
+        Quantity result;
+        const auto begin = m_text.data() + m_position;
+        const auto [end, error] = std::from_chars(begin, m_text.data() + m_text.size(), result.value);
+        if (error != std::errc{}) {
+            return std::nullopt;
+        }
+        m_position += end - begin;
+
+        while (m_position < m_text.size() && (std::isalpha(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '%')) {
+            result.unit += char(std::tolower(static_cast<unsigned char>(m_text[m_position++])));
+        }
+        return result;
+    }
+
+    void skipWhitespace()
+    {
+        while (m_position < m_text.size() && isWhitespace(m_text[m_position])) {
+            ++m_position;
+        }
+    }
+
+    std::string_view m_text;
+    std::size_t m_position = 0;
+};
+
+static std::string formatQuantity(const Quantity &quantity)
+{
+    // Avoid results like 0.30000000000000004px.
+    auto value = std::round(quantity.value * 1e6) / 1e6;
+    if (value == 0.0) {
+        value = 0.0;
+    }
+
+    char buffer[64];
+    const auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed);
+    return std::string(buffer, error == std::errc{} ? end : buffer) + quantity.unit;
+}
+
+CssPreprocessor::CssPreprocessor(const fs::path &outputDirectory)
+    : m_outputDirectory(outputDirectory)
+{
+}
+
+void CssPreprocessor::addFile(const fs::path &path)
+{
+    const auto canonical = fs::weakly_canonical(path);
+    if (m_fileIndices.contains(canonical)) {
+        return;
+    }
+
+    const auto index = m_files.size();
+    m_fileIndices.emplace(canonical, index);
+
+    File file;
+    file.source = canonical;
+    file.output = m_outputDirectory / (std::to_string(index) + "-" + canonical.filename().string());
+
+    std::ifstream stream(canonical, std::ios::binary);
+    if (!stream) {
+        m_errors.push_back(Error{.file = canonical, .line = 0, .message = "Could not read file"});
+    } else {
+        file.text.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    m_files.push_back(std::move(file));
+    scan(index);
+}
+
+bool CssPreprocessor::process()
+{
+    std::vector<std::map<std::size_t, std::string>> insertions(m_files.size());
+
+    for (const auto &usage : m_usages) {
+        const auto directory = m_files[usage.file].source.parent_path();
+
+        std::vector<std::string> values;
+        for (const auto &selector : usage.selectors) {
+            std::vector<std::string> resolving;
+            auto value = resolve(usage.value, selector, resolving, usage);
+            auto folded = foldCalc(value);
+            if (!folded) {
+                addError(usage.file, usage.begin, "Could not evaluate calc() in \"" + value + "\"");
+            }
+            values.push_back(absoluteUrls(folded.value_or(value), directory));
+        }
+
+        auto &file = m_files[usage.file];
+        const auto blank = blankRange(file.text, usage.begin, usage.end);
+        if (std::ranges::adjacent_find(values, std::ranges::not_equal_to{}) == values.end()) {
+            file.edits.push_back(Edit{.begin = usage.begin, .end = usage.end, .replacement = usage.name + ": " + values.front() + ";" + blank});
+            continue;
+        }
+
+        // The value depends on which selector of the rule matches, so split
+        // the declaration into a rule for each selector, placed right after
+        // the rule containing it.
+        file.edits.push_back(Edit{.begin = usage.begin, .end = usage.end, .replacement = blank});
+        auto &insertion = insertions[usage.file][std::min(usage.ruleEnd, file.text.size())];
+        for (std::size_t index = 0; index < values.size(); ++index) {
+            insertion += " " + usage.selectors[index] + " { " + usage.name + ": " + values[index] + "; }";
+        }
+    }
+
+    std::error_code error;
+    fs::create_directories(m_outputDirectory, error);
+
+    bool result = true;
+    for (std::size_t index = 0; index < m_files.size(); ++index) {
+        auto &file = m_files[index];
+        for (const auto &[position, text] : insertions[index]) {
+            file.edits.push_back(Edit{.begin = position, .end = position, .replacement = text});
+        }
+
+        std::ranges::sort(file.edits, std::ranges::greater{}, &Edit::begin);
+
+        auto text = file.text;
+        for (const auto &edit : file.edits) {
+            text.replace(edit.begin, edit.end - edit.begin, edit.replacement);
+        }
+
+        std::ofstream stream(file.output, std::ios::binary | std::ios::trunc);
+        stream << text;
+        if (!stream) {
+            m_errors.push_back(Error{.file = file.source, .line = 0, .message = "Could not write " + file.output.string()});
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+fs::path CssPreprocessor::outputPath(const fs::path &sourcePath) const
+{
+    auto itr = m_fileIndices.find(fs::weakly_canonical(sourcePath));
+    if (itr == m_fileIndices.end()) {
+        return sourcePath;
+    }
+    return m_files[itr->second].output;
+}
+
+fs::path CssPreprocessor::sourcePath(const fs::path &outputPath) const
+{
+    auto itr = std::ranges::find(m_files, outputPath, &File::output);
+    if (itr == m_files.end()) {
+        return outputPath;
+    }
+    return itr->source;
+}
+
+std::vector<CssPreprocessor::Error> CssPreprocessor::errors() const
+{
+    return m_errors;
+}
+
+std::optional<std::string> CssPreprocessor::foldCalc(const std::string &value)
+{
+    std::string result;
+    std::size_t position = 0;
+    while (true) {
+        const auto start = findFunction(value, "calc", position);
+        if (start == npos) {
+            break;
+        }
+
+        const auto end = findClosing(value, start + 4);
+        if (end == npos) {
+            return std::nullopt;
+        }
+
+        auto quantity = CalcParser(std::string_view(value).substr(start, end - start + 1)).parse();
+        if (!quantity) {
+            return std::nullopt;
+        }
+
+        result += value.substr(position, start - position);
+        result += formatQuantity(quantity.value());
+        position = end + 1;
+    }
+
+    result += value.substr(position);
+    return result;
+}
+
+void CssPreprocessor::scan(std::size_t fileIndex)
+{
+    // Imported files are added while scanning, so keep a copy of the text.
+    const std::string text = m_files[fileIndex].text;
+    const auto directory = m_files[fileIndex].source.parent_path();
+
+    struct Rule {
+        std::vector<std::string> selectors;
+    };
+    std::vector<Rule> rules;
+    std::vector<std::size_t> pendingUsages;
+
+    std::size_t start = 0;
+    for (std::size_t index = 0; index < text.size();) {
+        const auto skipped = skipStringOrComment(text, index);
+        if (skipped != index) {
+            index = skipped;
+            continue;
+        }
+
+        const auto c = text[index];
+        if (c == '(') {
+            const auto end = findClosing(text, index);
+            index = end == npos ? text.size() : end + 1;
+            continue;
+        }
+
+        if (c == '{') {
+            const auto prelude = trimmed(stripComments(std::string_view(text).substr(start, index - start)));
+            if (prelude.starts_with('@')) {
+                // At-rules like @property do not contain anything to resolve.
+                // Custom property declarations are removed, so a var() inside
+                // an at-rule would be left without a value.
+                const auto atRuleBegin = index;
+                int depth = 0;
+                for (; index < text.size(); ++index) {
+                    const auto skippedInner = skipStringOrComment(text, index);
+                    if (skippedInner != index) {
+                        index = skippedInner - 1;
+                    } else if (text[index] == '{') {
+                        ++depth;
+                    } else if (text[index] == '}' && --depth == 0) {
+                        break;
+                    }
+                }
+                if (findFunction(std::string_view(text).substr(atRuleBegin, index - atRuleBegin), "var", 0) != npos) {
+                    addError(fileIndex, atRuleBegin, "var() is not supported inside at-rules");
+                }
+                start = ++index;
+                continue;
+            }
+
+            Rule rule;
+            for (const auto &selector : splitTopLevel(prelude, ',')) {
+                if (rules.empty()) {
+                    rule.selectors.push_back(normalizeSelector(selector));
+                } else {
+                    for (const auto &parent : rules.back().selectors) {
+                        rule.selectors.push_back(nestSelector(parent, selector));
+                    }
+                }
+            }
+            rules.push_back(std::move(rule));
+            start = ++index;
+            continue;
+        }
+
+        if (c != ';' && c != '}') {
+            ++index;
+            continue;
+        }
+
+        const auto statementEnd = c == ';' ? index + 1 : index;
+
+        auto begin = start;
+        while (begin < index) {
+            const auto skippedInner = skipStringOrComment(text, begin);
+            if (skippedInner != begin) {
+                begin = skippedInner;
+            } else if (isWhitespace(text[begin])) {
+                ++begin;
+            } else {
+                break;
+            }
+        }
+
+        const auto statement = std::string_view(text).substr(begin, index - begin);
+        if (rules.empty() && statement.starts_with("@import")) {
+            auto target = trimmed(statement.substr(7));
+            if (target.starts_with("url(") && target.ends_with(')')) {
+                target = trimmed(std::string_view(target).substr(4, target.size() - 5));
+            }
+            if (target.size() >= 2 && (target.front() == '"' || target.front() == '\'')) {
+                target = target.substr(1, target.size() - 2);
+            }
+
+            const auto path = directory / target;
+            addFile(path);
+
+            auto &file = m_files[fileIndex];
+            file.edits.push_back(Edit{
+                .begin = begin,
+                .end = statementEnd,
+                .replacement = "@import \"" + outputPath(path).string() + "\";" + blankRange(text, begin, statementEnd),
+            });
+        } else if (!rules.empty() && !statement.empty()) {
+            const auto colon = statement.find(':');
+            if (colon != npos) {
+                auto name = trimmed(statement.substr(0, colon));
+                auto value = trimmed(stripComments(statement.substr(colon + 1)));
+
+                if (name.starts_with("--")) {
+                    // Every var() is substituted here, so the parser never
+                    // needs to see the declaration itself.
+                    const auto &selectors = rules.back().selectors;
+                    const bool root = std::ranges::all_of(selectors, [](const auto &selector) {
+                        return selector == ":root";
+                    });
+                    m_customProperties.push_back(CustomProperty{
+                        .name = name,
+                        .value = value,
+                        .scopes = root ? std::vector<std::string>{} : selectors,
+                        .order = m_customProperties.size(),
+                    });
+                    m_files[fileIndex].edits.push_back(Edit{.begin = begin, .end = statementEnd, .replacement = blankRange(text, begin, statementEnd)});
+                } else if (findFunction(value, "var", 0) != npos || findFunction(value, "calc", 0) != npos || findFunction(value, "url", 0) != npos) {
+                    pendingUsages.push_back(m_usages.size());
+                    m_usages.push_back(Usage{
+                        .file = fileIndex,
+                        .begin = begin,
+                        .end = statementEnd,
+                        .name = name,
+                        .value = value,
+                        .selectors = rules.back().selectors,
+                        .ruleEnd = npos,
+                    });
+                }
+            }
+        }
+
+        if (c == '}' && !rules.empty()) {
+            rules.pop_back();
+            if (rules.empty()) {
+                for (auto usage : pendingUsages) {
+                    m_usages[usage].ruleEnd = index + 1;
+                }
+                pendingUsages.clear();
+            }
+        }
+
+        start = ++index;
+    }
+}
+
+std::string CssPreprocessor::resolve(const std::string &value, const std::string &selector, std::vector<std::string> &resolving, const Usage &usage)
+{
+    std::string result;
+    std::size_t position = 0;
+    while (true) {
+        const auto start = findFunction(value, "var", position);
+        if (start == npos) {
+            break;
+        }
+
+        const auto end = findClosing(value, start + 3);
+        if (end == npos) {
+            addError(usage.file, usage.begin, "Unbalanced parentheses in \"" + value + "\"");
+            break;
+        }
+
+        result += value.substr(position, start - position);
+        position = end + 1;
+
+        const auto arguments = splitTopLevel(std::string_view(value).substr(start + 4, end - start - 4), ',', 2);
+        const auto &name = arguments.front();
+
+        if (std::ranges::find(resolving, name) != resolving.end()) {
+            addError(usage.file, usage.begin, "Custom property " + name + " refers to itself");
+            result += value.substr(start, end - start + 1);
+            continue;
+        }
+
+        if (auto property = lookup(name, selector)) {
+            resolving.push_back(name);
+            result += resolve(property->value, selector, resolving, usage);
+            resolving.pop_back();
+        } else if (arguments.size() > 1) {
+            result += resolve(arguments.back(), selector, resolving, usage);
+        } else {
+            addError(usage.file, usage.begin, "Unknown custom property " + name + " for " + selector);
+            result += value.substr(start, end - start + 1);
+        }
+    }
+
+    result += value.substr(position);
+    return result;
+}
+
+const CssPreprocessor::CustomProperty *CssPreprocessor::lookup(const std::string &name, const std::string &selector) const
+{
+    const auto subject = compounds(selector);
+
+    const CustomProperty *result = nullptr;
+    std::pair<std::size_t, std::size_t> resultRank;
+    for (const auto &property : m_customProperties) {
+        if (property.name != name) {
+            continue;
+        }
+
+        std::optional<std::pair<std::size_t, std::size_t>> rank;
+        if (property.scopes.empty()) {
+            rank = std::make_pair(0, 0);
+        }
+        for (const auto &scope : property.scopes) {
+            auto scopeRank = scope == ":root" ? std::make_optional(std::make_pair(std::size_t(0), std::size_t(0))) : matchScope(compounds(scope), subject);
+            if (scopeRank && (!rank || scopeRank.value() > rank.value())) {
+                rank = scopeRank;
+            }
+        }
+
+        // Properties are in source order, so later declarations win ties.
+        if (rank && (!result || rank.value() >= resultRank)) {
+            result = &property;
+            resultRank = rank.value();
+        }
+    }
+    return result;
+}
+
+std::string CssPreprocessor::absoluteUrls(const std::string &value, const fs::path &directory) const
+{
+    std::string result;
+    std::size_t position = 0;
+    while (true) {
+        const auto start = findFunction(value, "url", position);
+        if (start == npos) {
+            break;
+        }
+
+        const auto end = findClosing(value, start + 3);
+        if (end == npos) {
+            break;
+        }
+
+        auto target = trimmed(std::string_view(value).substr(start + 4, end - start - 4));
+        if (target.size() >= 2 && (target.front() == '"' || target.front() == '\'')) {
+            target = target.substr(1, target.size() - 2);
+        }
+
+        result += value.substr(position, start - position);
+        if (target.empty() || target.find(':') != npos || fs::path(target).is_absolute()) {
+            result += value.substr(start, end - start + 1);
+        } else {
+            result += "url(\"" + (directory / target).lexically_normal().string() + "\")";
+        }
+        position = end + 1;
+    }
+
+    result += value.substr(position);
+    return result;
+}
+
+void CssPreprocessor::addError(std::size_t fileIndex, std::size_t position, const std::string &message)
+{
+    const auto &file = m_files[fileIndex];
+    const auto line = std::count(file.text.begin(), file.text.begin() + std::min(position, file.text.size()), '\n') + 1;
+    m_errors.push_back(Error{.file = file.source, .line = std::size_t(line), .message = message});
+}
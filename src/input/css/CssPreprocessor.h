@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*!
+ * Resolves selector-scoped custom properties and calc() before parsing.
+ *
+ * cxx-rust-cssparser substitutes custom properties globally, so a custom
+ * property can only be defined once, on :root, and it does not support calc()
+ * at all. This processes a stylesheet and everything it imports beforehand:
+ *
+ * - Custom properties may be declared in any rule. A declaration applies to
+ *   rules whose selector contains the selector of the declaring rule, like
+ *   "toolbar button" for a property declared on "toolbar", as well as to
+ *   rules nested inside the declaring rule. The declaration closest to the
+ *   subject of a selector wins, after that the last one declared. Properties
+ *   declared on :root apply everywhere.
+ * - calc() expressions are folded into a single value once all var() inside
+ *   them are substituted. Addition and subtraction require values of the same
+ *   unit, multiplication and division require one side to be a number.
+ *
+ * Each var() used outside of :root is replaced with its value for the
+ * selector of the rule it is used in, so the parser only sees plain values.
+ * If the value differs between the selectors of a rule, the declaration is
+ * split into separate rules for each selector. Relative paths in url() and
+ * @import are made absolute, as the processed files are written to a
+ * different directory. Processing keeps every line where it was, so line
+ * numbers reported for the processed files also apply to the original files.
+ *
+ * Scopes are matched on the text of the selectors rather than on parsed
+ * selectors, which has some limits:
+ *
+ * - The compounds of the declaring selector need to match consecutive
+ *   compounds of the using selector with the same combinators. A property
+ *   declared on "toolbar button" does not apply to "toolbar row button".
+ * - A compound refines another if it starts with it, so simple selectors need
+ *   to be written in the same order. "button.flat:hover" is refined by a
+ *   declaration on "button.flat", but "button:hover.flat" is not.
+ * - Conditions are part of the selector, so a property declared with certain
+ *   conditions only applies to rules that start with the same conditions, in
+ *   the same order.
+ * - The contents of at-rules are not processed. Using var() inside an at-rule
+ *   is reported as an error.
+ */
+class CssPreprocessor
+{
+public:
+    struct Error {
+        std::filesystem::path file;
+        std::size_t line = 0;
+        std::string message;
+    };
+
+    explicit CssPreprocessor(const std::filesystem::path &outputDirectory);
+
+    /*!
+     * Add the stylesheet at \p path, along with all stylesheets it imports.
+     *
+     * Files are ordered like they would be when importing them, so custom
+     * properties declared in a file added later take precedence.
+     */
+    void addFile(const std::filesystem::path &path);
+
+    /*!
+     * Resolve all added files and write the results to the output directory.
+     *
+     * Returns false if a file could not be written.
+     */
+    bool process();
+
+    /*!
+     * Returns the path of the processed file for \p sourcePath.
+     */
+    std::filesystem::path outputPath(const std::filesystem::path &sourcePath) const;
+
+    /*!
+     * Returns the path of the original file for the processed file at \p outputPath.
+     *
+     * Returns \p outputPath if it is not a processed file.
+     */
+    std::filesystem::path sourcePath(const std::filesystem::path &outputPath) const;
+
+    /*!
+     * Returns the errors encountered while processing.
+     */
+    std::vector<Error> errors() const;
+
+    /*!
+     * Fold all calc() expressions in \p value.
+     *
+     * Returns std::nullopt if an expression could not be folded.
+     */
+    static std::optional<std::string> foldCalc(const std::string &value);
+
+private:
+    struct Edit {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::string replacement;
+    };
+
+    struct File {
+        std::filesystem::path source;
+        std::filesystem::path output;
+        std::string text;
+        std::vector<Edit> edits;
+    };
+
+    struct CustomProperty {
+        std::string name;
+        std::string value;
+        // Empty for properties declared on :root.
+        std::vector<std::string> scopes;
+        std::size_t order = 0;
+    };
+
+    struct Usage {
+        std::size_t file = 0;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::string name;
+        std::string value;
+        std::vector<std::string> selectors;
+        // Position after the top-level rule containing the declaration.
+        std::size_t ruleEnd = 0;
+    };
+
+    void scan(std::size_t fileIndex);
+    std::string resolve(const std::string &value, const std::string &selector, std::vector<std::string> &resolving, const Usage &usage);
+    const CustomProperty *lookup(const std::string &name, const std::string &selector) const;
+    std::string absoluteUrls(const std::string &value, const std::filesystem::path &directory) const;
+    void addError(std::size_t fileIndex, std::size_t position, const std::string &message);
+
+    std::filesystem::path m_outputDirectory;
+    std::vector<File> m_files;
+    std::map<std::filesystem::path, std::size_t> m_fileIndices;
+    std::vector<CustomProperty> m_customProperties;
+    std::vector<Usage> m_usages;
+    std::vector<Error> m_errors;
+};
@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+/*
+ * This file is automatically generated from css-property-table.h.j2.
+ * To regenerate, run `tools/propertygenerator/generate_properties.py`.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <string_view>
+
+namespace cssparser
+{
+struct Property;
+}
+
+namespace Union::Properties
+{
+class StylePropertyGroup;
+}
+
+// Sets the value of a single CSS property. stylePath is the directory of the
+// style, used to resolve relative paths.
+using CssPropertySetter = void (*)(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+
+// The setters for each CSS property. These are implemented by CssLoader.
+namespace CssPropertySetters
+{
+void background(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void backgroundColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void backgroundImage(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void backgroundImageHeight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void backgroundImageMaskColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void backgroundImageWidth(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void backgroundImageXOffset(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void backgroundImageYOffset(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void border(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderBottom(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderBottomColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderBottomLeftRadius(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderBottomRightRadius(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderBottomStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderBottomWidth(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderLeft(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderLeftColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderLeftStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderLeftWidth(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderRadius(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderRight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderRightColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderRightStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderRightWidth(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderTop(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderTopColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderTopLeftRadius(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderTopRightRadius(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderTopStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderTopWidth(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void borderWidth(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void boxShadow(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void color(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void fontFamily(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void fontSize(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void fontWeight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void height(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconAlignment(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconAlignmentContainer(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconAlignmentHorizontal(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconAlignmentOrder(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconAlignmentVertical(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconHeight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconName(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconSize(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconSource(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void iconWidth(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void inset(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void insetBottom(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void insetLeft(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void insetRight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void insetTop(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void layoutAlignment(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void layoutAlignmentContainer(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void layoutAlignmentHorizontal(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void layoutAlignmentOrder(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void layoutAlignmentVertical(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void margin(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void marginBottom(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void marginLeft(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void marginRight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void marginTop(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void opacity(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outline(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineBottom(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineBottomColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineBottomSize(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineBottomStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineLeft(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineLeftColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineLeftSize(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineLeftStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineRight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineRightColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineRightSize(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineRightStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineTop(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineTopColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineTopSize(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void outlineTopStyle(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void padding(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void paddingBottom(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void paddingLeft(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void paddingRight(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void paddingTop(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void shadowBlur(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void shadowColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void shadowOffsetHorizontal(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void shadowOffsetVertical(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void shadowSize(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void spacing(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textAlignment(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textAlignmentContainer(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textAlignmentHorizontal(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textAlignmentOrder(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textAlignmentVertical(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textColor(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textElide(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void textWrapMode(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void visibility(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+void width(Union::Properties::StylePropertyGroup *output, const cssparser::Property &property, const std::filesystem::path &stylePath);
+}
+
+struct CssProperty {
+    std::string_view name;
+    CssPropertySetter setter;
+};
+
+// All known CSS properties, sorted by name so they can be found using a binary
+// search.
+inline constexpr std::array CssProperties = {
+    CssProperty{"background", &CssPropertySetters::background},
+    CssProperty{"background-color", &CssPropertySetters::backgroundColor},
+    CssProperty{"background-image", &CssPropertySetters::backgroundImage},
+    CssProperty{"background-image-height", &CssPropertySetters::backgroundImageHeight},
+    CssProperty{"background-image-mask-color", &CssPropertySetters::backgroundImageMaskColor},
+    CssProperty{"background-image-width", &CssPropertySetters::backgroundImageWidth},
+    CssProperty{"background-image-x-offset", &CssPropertySetters::backgroundImageXOffset},
+    CssProperty{"background-image-y-offset", &CssPropertySetters::backgroundImageYOffset},
+    CssProperty{"border", &CssPropertySetters::border},
+    CssProperty{"border-bottom", &CssPropertySetters::borderBottom},
+    CssProperty{"border-bottom-color", &CssPropertySetters::borderBottomColor},
+    CssProperty{"border-bottom-left-radius", &CssPropertySetters::borderBottomLeftRadius},
+    CssProperty{"border-bottom-right-radius", &CssPropertySetters::borderBottomRightRadius},
+    CssProperty{"border-bottom-style", &CssPropertySetters::borderBottomStyle},
+    CssProperty{"border-bottom-width", &CssPropertySetters::borderBottomWidth},
+    CssProperty{"border-color", &CssPropertySetters::borderColor},
+    CssProperty{"border-left", &CssPropertySetters::borderLeft},
+    CssProperty{"border-left-color", &CssPropertySetters::borderLeftColor},
+    CssProperty{"border-left-style", &CssPropertySetters::borderLeftStyle},
+    CssProperty{"border-left-width", &CssPropertySetters::borderLeftWidth},
+    CssProperty{"border-radius", &CssPropertySetters::borderRadius},
+    CssProperty{"border-right", &CssPropertySetters::borderRight},
+    CssProperty{"border-right-color", &CssPropertySetters::borderRightColor},
+    CssProperty{"border-right-style", &CssPropertySetters::borderRightStyle},
+    CssProperty{"border-right-width", &CssPropertySetters::borderRightWidth},
+    CssProperty{"border-style", &CssPropertySetters::borderStyle},
+    CssProperty{"border-top", &CssPropertySetters::borderTop},
+    CssProperty{"border-top-color", &CssPropertySetters::borderTopColor},
+    CssProperty{"border-top-left-radius", &CssPropertySetters::borderTopLeftRadius},
+    CssProperty{"border-top-right-radius", &CssPropertySetters::borderTopRightRadius},
+    CssProperty{"border-top-style", &CssPropertySetters::borderTopStyle},
+    CssProperty{"border-top-width", &CssPropertySetters::borderTopWidth},
+    CssProperty{"border-width", &CssPropertySetters::borderWidth},
+    CssProperty{"box-shadow", &CssPropertySetters::boxShadow},
+    CssProperty{"color", &CssPropertySetters::color},
+    CssProperty{"font-family", &CssPropertySetters::fontFamily},
+    CssProperty{"font-size", &CssPropertySetters::fontSize},
+    CssProperty{"font-weight", &CssPropertySetters::fontWeight},
+    CssProperty{"height", &CssPropertySetters::height},
+    CssProperty{"icon-alignment", &CssPropertySetters::iconAlignment},
+    CssProperty{"icon-alignment-container", &CssPropertySetters::iconAlignmentContainer},
+    CssProperty{"icon-alignment-horizontal", &CssPropertySetters::iconAlignmentHorizontal},
+    CssProperty{"icon-alignment-order", &CssPropertySetters::iconAlignmentOrder},
+    CssProperty{"icon-alignment-vertical", &CssPropertySetters::iconAlignmentVertical},
+    CssProperty{"icon-color", &CssPropertySetters::iconColor},
+    CssProperty{"icon-height", &CssPropertySetters::iconHeight},
+    CssProperty{"icon-name", &CssPropertySetters::iconName},
+    CssProperty{"icon-size", &CssPropertySetters::iconSize},
+    CssProperty{"icon-source", &CssPropertySetters::iconSource},
+    CssProperty{"icon-width", &CssPropertySetters::iconWidth},
+    CssProperty{"inset", &CssPropertySetters::inset},
+    CssProperty{"inset-bottom", &CssPropertySetters::insetBottom},
+    CssProperty{"inset-left", &CssPropertySetters::insetLeft},
+    CssProperty{"inset-right", &CssPropertySetters::insetRight},
+    CssProperty{"inset-top", &CssPropertySetters::insetTop},
+    CssProperty{"layout-alignment", &CssPropertySetters::layoutAlignment},
+    CssProperty{"layout-alignment-container", &CssPropertySetters::layoutAlignmentContainer},
+    CssProperty{"layout-alignment-horizontal", &CssPropertySetters::layoutAlignmentHorizontal},
+    CssProperty{"layout-alignment-order", &CssPropertySetters::layoutAlignmentOrder},
+    CssProperty{"layout-alignment-vertical", &CssPropertySetters::layoutAlignmentVertical},
+    CssProperty{"margin", &CssPropertySetters::margin},
+    CssProperty{"margin-bottom", &CssPropertySetters::marginBottom},
+    CssProperty{"margin-left", &CssPropertySetters::marginLeft},
+    CssProperty{"margin-right", &CssPropertySetters::marginRight},
+    CssProperty{"margin-top", &CssPropertySetters::marginTop},
+    CssProperty{"opacity", &CssPropertySetters::opacity},
+    CssProperty{"outline", &CssPropertySetters::outline},
+    CssProperty{"outline-bottom", &CssPropertySetters::outlineBottom},
+    CssProperty{"outline-bottom-color", &CssPropertySetters::outlineBottomColor},
+    CssProperty{"outline-bottom-size", &CssPropertySetters::outlineBottomSize},
+    CssProperty{"outline-bottom-style", &CssPropertySetters::outlineBottomStyle},
+    CssProperty{"outline-left", &CssPropertySetters::outlineLeft},
+    CssProperty{"outline-left-color", &CssPropertySetters::outlineLeftColor},
+    CssProperty{"outline-left-size", &CssPropertySetters::outlineLeftSize},
+    CssProperty{"outline-left-style", &CssPropertySetters::outlineLeftStyle},
+    CssProperty{"outline-right", &CssPropertySetters::outlineRight},
+    CssProperty{"outline-right-color", &CssPropertySetters::outlineRightColor},
+    CssProperty{"outline-right-size", &CssPropertySetters::outlineRightSize},
+    CssProperty{"outline-right-style", &CssPropertySetters::outlineRightStyle},
+    CssProperty{"outline-top", &CssPropertySetters::outlineTop},
+    CssProperty{"outline-top-color", &CssPropertySetters::outlineTopColor},
+    CssProperty{"outline-top-size", &CssPropertySetters::outlineTopSize},
+    CssProperty{"outline-top-style", &CssPropertySetters::outlineTopStyle},
+    CssProperty{"padding", &CssPropertySetters::padding},
+    CssProperty{"padding-bottom", &CssPropertySetters::paddingBottom},
+    CssProperty{"padding-left", &CssPropertySetters::paddingLeft},
+    CssProperty{"padding-right", &CssPropertySetters::paddingRight},
+    CssProperty{"padding-top", &CssPropertySetters::paddingTop},
+    CssProperty{"shadow-blur", &CssPropertySetters::shadowBlur},
+    CssProperty{"shadow-color", &CssPropertySetters::shadowColor},
+    CssProperty{"shadow-offset-horizontal", &CssPropertySetters::shadowOffsetHorizontal},
+    CssProperty{"shadow-offset-vertical", &CssPropertySetters::shadowOffsetVertical},
+    CssProperty{"shadow-size", &CssPropertySetters::shadowSize},
+    CssProperty{"spacing", &CssPropertySetters::spacing},
+    CssProperty{"text-alignment", &CssPropertySetters::textAlignment},
+    CssProperty{"text-alignment-container", &CssPropertySetters::textAlignmentContainer},
+    CssProperty{"text-alignment-horizontal", &CssPropertySetters::textAlignmentHorizontal},
+    CssProperty{"text-alignment-order", &CssPropertySetters::textAlignmentOrder},
+    CssProperty{"text-alignment-vertical", &CssPropertySetters::textAlignmentVertical},
+    CssProperty{"text-color", &CssPropertySetters::textColor},
+    CssProperty{"text-elide", &CssPropertySetters::textElide},
+    CssProperty{"text-wrap-mode", &CssPropertySetters::textWrapMode},
+    CssProperty{"visibility", &CssPropertySetters::visibility},
+    CssProperty{"width", &CssPropertySetters::width},
+};
+
+static_assert(std::ranges::is_sorted(CssProperties, {}, &CssProperty::name), "CssProperties should be sorted by name");
+
+// Returns the setter for the property called name, or nullptr if the property
+// is unknown.
+inline CssPropertySetter findCssPropertySetter(std::string_view name)
+{
+    auto itr = std::ranges::lower_bound(CssProperties, name, {}, &CssProperty::name);
+    if (itr == CssProperties.end() || itr->name != name) {
+        return nullptr;
+    }
+    return itr->setter;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Returns the argument of a functional pseudo-class, like "2n+1" for
+// "nth-child(2n+1)".
+inline std::string_view pseudo_class_argument(std::string_view name)
+{
+    const auto open = name.find('(');
+    if (open == std::string_view::npos) {
+        return std::string_view{};
+    }
+
+    const auto argument = name.substr(open + 1);
+    return argument.substr(0, argument.find(')'));
+}
+
+// Parses the argument of :nth-child(), like "2n+1", "odd" or "3", into the
+// pair of a and b in an+b.
+inline std::optional<std::pair<int, int>> parse_nth(std::string_view argument)
+{
+    std::string value;
+    std::ranges::copy_if(argument, std::back_inserter(value), [](char character) {
+        return character != ' ';
+    });
+
+    if (value == "odd") {
+        return std::make_pair(2, 1);
+    } else if (value == "even") {
+        return std::make_pair(2, 0);
+    }
+
+    auto parseInt = [](std::string_view string) -> std::optional<int> {
+        if (string.starts_with('+')) {
+            string.remove_prefix(1);
+        }
+
+        int result = 0;
+        auto [end, error] = std::from_chars(string.data(), string.data() + string.size(), result);
+        if (string.empty() || error != std::errc{} || end != string.data() + string.size()) {
+            return std::nullopt;
+        }
+        return result;
+    };
+
+    const auto n = value.find('n');
+    if (n == std::string::npos) {
+        auto b = parseInt(value);
+        return b ? std::optional(std::make_pair(0, b.value())) : std::nullopt;
+    }
+
+    const auto aPart = std::string_view(value).substr(0, n);
+    const auto bPart = std::string_view(value).substr(n + 1);
+
+    std::optional<int> a;
+    if (aPart.empty() || aPart == "+") {
+        a = 1;
+    } else if (aPart == "-") {
+        a = -1;
+    } else {
+        a = parseInt(aPart);
+    }
+
+    auto b = bPart.empty() ? std::optional(0) : parseInt(bPart);
+    if (!a || !b || (!bPart.empty() && bPart.front() != '+' && bPart.front() != '-')) {
+        return std::nullopt;
+    }
+
+    return std::make_pair(a.value(), b.value());
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "PlasmaSvgAtlas.h"
+
+#include <algorithm>
+
+#include <QPainter>
+
+#include "PlasmaSvgRenderer.h"
+
+// The size of a single atlas page. Elements that do not fit in a page get a
+// page of their own.
+static constexpr int PageSize = 1024;
+// The maximum number of pages to keep, including pages for large elements.
+// With 4 bytes per pixel this limits the atlas to 16 MiB, apart from pages
+// that are still used by images returned earlier.
+static constexpr qsizetype MaxPages = 4;
+
+std::size_t qHash(const PlasmaSvgAtlas::Key &key, std::size_t seed)
+{
+    return qHashMulti(seed, key.renderer, key.element, key.size.width(), key.size.height());
+}
+
+QImage PlasmaSvgAtlas::image(const std::shared_ptr<PlasmaSvgRenderer> &renderer, const QString &element, const QSize &size)
+{
+    if (!renderer || size.isEmpty()) {
+        return QImage{};
+    }
+
+    Key key{renderer->id(), element, size};
+
+    QMutexLocker locker(&m_mutex);
+
+    auto itr = m_entries.constFind(key);
+    if (itr != m_entries.constEnd()) {
+        itr->page->lastUsed = ++m_usage;
+        return view(itr.value());
+    }
+
+    auto entry = allocate(size);
+
+    // Nothing else holds a reference to the page image, so painting into it
+    // does not detach it and existing views of other entries stay valid.
+    QPainter painter(&entry.page->image);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.fillRect(entry.rect, Qt::transparent);
+    painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+    renderer->render(&painter, element, entry.rect);
+    painter.end();
+
+    entry.page->keys.append(key);
+    entry.page->lastUsed = ++m_usage;
+    m_entries.insert(key, entry);
+    return view(entry);
+}
+
+void PlasmaSvgAtlas::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+    m_pages.clear();
+    m_currentPage.reset();
+}
+
+PlasmaSvgAtlas *PlasmaSvgAtlas::instance()
+{
+    static PlasmaSvgAtlas atlas;
+    return &atlas;
+}
+
+PlasmaSvgAtlas::Entry PlasmaSvgAtlas::allocate(const QSize &size)
+{
+    if (size.width() > PageSize || size.height() > PageSize) {
+        return Entry{createPage(size), QRect(QPoint(0, 0), size)};
+    }
+
+    // Elements are packed into shelves: rows that are as high as the highest
+    // element in them. Once a shelf is full, a new one is started below it.
+    auto fits = [&size](const Page &page) {
+        if (page.cursorX + size.width() <= PageSize && page.shelfY + std::max(page.shelfHeight, size.height()) <= PageSize) {
+            return true;
+        }
+        return page.shelfY + page.shelfHeight + size.height() <= PageSize;
+    };
+
+    if (!m_currentPage || !fits(*m_currentPage)) {
+        m_currentPage = createPage(QSize(PageSize, PageSize));
+    }
+
+    auto &page = *m_currentPage;
+    if (page.cursorX + size.width() > PageSize || page.shelfY + std::max(page.shelfHeight, size.height()) > PageSize) {
+        page.shelfY += page.shelfHeight;
+        page.shelfHeight = 0;
+        page.cursorX = 0;
+    }
+
+    QRect rect(QPoint(page.cursorX, page.shelfY), size);
+    page.cursorX += size.width();
+    page.shelfHeight = std::max(page.shelfHeight, size.height());
+
+    return Entry{m_currentPage, rect};
+}
+
+std::shared_ptr<PlasmaSvgAtlas::Page> PlasmaSvgAtlas::createPage(const QSize &size)
+{
+    // Release the least recently used pages to make room. Images returned
+    // earlier keep their page alive, so only the atlas forgets about it.
+    while (m_pages.size() >= MaxPages) {
+        const auto leastUsed = std::ranges::min_element(m_pages, {}, [](const auto &page) {
+            return page->lastUsed;
+        });
+
+        for (const auto &key : std::as_const((*leastUsed)->keys)) {
+            m_entries.remove(key);
+        }
+
+        if (*leastUsed == m_currentPage) {
+            m_currentPage.reset();
+        }
+
+        m_pages.erase(leastUsed);
+    }
+
+    auto page = std::make_shared<Page>();
+    page->image = QImage(size, QImage::Format_ARGB32_Premultiplied);
+    page->image.fill(Qt::transparent);
+    m_pages.append(page);
+    return page;
+}
+
+QImage PlasmaSvgAtlas::view(const Entry &entry)
+{
+    const auto &image = entry.page->image;
+    const auto bits = image.constBits() + entry.rect.y() * image.bytesPerLine() + entry.rect.x() * (image.depth() / 8);
+
+    // The view refers to the page's pixels directly, so keep the page alive
+    // until the view is destroyed.
+    return QImage(
+        bits,
+        entry.rect.width(),
+        entry.rect.height(),
+        image.bytesPerLine(),
+        image.format(),
+        [](void *page) {
+            delete static_cast<std::shared_ptr<Page> *>(page);
+        },
+        new std::shared_ptr<Page>(entry.page));
+}
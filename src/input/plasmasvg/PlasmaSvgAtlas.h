@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <memory>
+
+#include <QHash>
+#include <QImage>
+#include <QList>
+#include <QMutex>
+
+class PlasmaSvgRenderer;
+
+/**
+ * A shared atlas of rasterized SVG elements.
+ *
+ * Elements are rendered into large pages the first time they are requested at
+ * a certain size, after which the same pixels are shared by everything that
+ * requests the element at that size. The returned images are read-only views
+ * into a page that keep the page alive for as long as they exist.
+ *
+ * A limited number of pages is kept. When another page is needed, the least
+ * recently used page is released along with all elements in it.
+ */
+class PlasmaSvgAtlas
+{
+public:
+    /**
+     * Entries are identified by the renderer that produced them. A renderer
+     * always renders with the same colors, so changed colors result in a new
+     * renderer and never in stale entries.
+     */
+    struct Key {
+        quint64 renderer = 0;
+        QString element;
+        QSize size;
+
+        bool operator==(const Key &other) const = default;
+    };
+
+    /**
+     * Returns an image of element rendered by renderer at size pixels.
+     *
+     * The element is rasterized if it was not yet in the atlas.
+     */
+    QImage image(const std::shared_ptr<PlasmaSvgRenderer> &renderer, const QString &element, const QSize &size);
+
+    /**
+     * Drop all entries from the atlas.
+     *
+     * Images that were returned before remain valid.
+     */
+    void clear();
+
+    static PlasmaSvgAtlas *instance();
+
+private:
+    struct Page {
+        QImage image;
+        int shelfY = 0;
+        int shelfHeight = 0;
+        int cursorX = 0;
+        quint64 lastUsed = 0;
+        QList<Key> keys;
+    };
+
+    struct Entry {
+        std::shared_ptr<Page> page;
+        QRect rect;
+    };
+
+    Entry allocate(const QSize &size);
+    std::shared_ptr<Page> createPage(const QSize &size);
+    static QImage view(const Entry &entry);
+
+    QMutex m_mutex;
+    std::shared_ptr<Page> m_currentPage;
+    QList<std::shared_ptr<Page>> m_pages;
+    QHash<Key, Entry> m_entries;
+    quint64 m_usage = 0;
+};
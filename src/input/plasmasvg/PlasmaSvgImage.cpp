@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "PlasmaSvgImage.h"
+
+#include <QPainter>
+
+#include "PlasmaSvgAtlas.h"
+#include "PlasmaSvgRenderer.h"
+
+bool PlasmaSvgImage::isNull() const
+{
+    return m_layers.isEmpty() || m_size.isEmpty();
+}
+
+QSizeF PlasmaSvgImage::size() const
+{
+    return m_size;
+}
+
+QImage PlasmaSvgImage::image(const QSizeF &size, qreal devicePixelRatio) const
+{
+    if (isNull() || size.isEmpty()) {
+        return QImage{};
+    }
+
+    const auto pixelSize = (size * devicePixelRatio).toSize();
+    auto atlas = PlasmaSvgAtlas::instance();
+
+    // A single element covering the whole image can be used from the atlas
+    // as-is, without copying.
+    if (m_layers.size() == 1 && m_layers.first().rect == QRectF(QPointF(0, 0), m_size)) {
+        const auto &layer = m_layers.first();
+        auto result = atlas->image(layer.renderer, layer.element, pixelSize);
+        result.setDevicePixelRatio(devicePixelRatio);
+        return result;
+    }
+
+    QImage result(pixelSize, QImage::Format_ARGB32_Premultiplied);
+    result.fill(Qt::transparent);
+
+    const auto xScale = pixelSize.width() / m_size.width();
+    const auto yScale = pixelSize.height() / m_size.height();
+
+    QPainter painter(&result);
+    for (const auto &layer : m_layers) {
+        const auto target = QRectF(layer.rect.x() * xScale, layer.rect.y() * yScale, layer.rect.width() * xScale, layer.rect.height() * yScale).toRect();
+        const auto image = atlas->image(layer.renderer, layer.element, target.size());
+        if (!image.isNull()) {
+            painter.drawImage(target, image);
+        }
+    }
+    painter.end();
+
+    result.setDevicePixelRatio(devicePixelRatio);
+    return result;
+}
+
+QImage PlasmaSvgImage::image() const
+{
+    return image(m_size);
+}
+
+PlasmaSvgImage PlasmaSvgImage::fromElement(const std::shared_ptr<PlasmaSvgRenderer> &renderer, const QString &element)
+{
+    PlasmaSvgImage result;
+    if (!renderer || !renderer->elementExists(element)) {
+        return result;
+    }
+
+    result.m_size = renderer->elementRect(element).size();
+    result.m_layers.append(Layer{renderer, element, QRectF(QPointF(0, 0), result.m_size)});
+    return result;
+}
+
+PlasmaSvgImage PlasmaSvgImage::blend(const QList<PlasmaSvgImage> &images, Qt::Alignment align, Qt::Orientations stretch)
+{
+    PlasmaSvgImage result;
+
+    for (const auto &image : images) {
+        result.m_size = result.m_size.expandedTo(image.m_size);
+    }
+
+    for (const auto &image : images) {
+        QPointF position;
+        QSizeF size = image.m_size;
+        if (align & Qt::AlignLeft) {
+            position.setX(0);
+        } else if (align & Qt::AlignHCenter) {
+            position.setX((result.m_size.width() - size.width()) / 2);
+        } else if (align & Qt::AlignRight) {
+            position.setX(result.m_size.width() - size.width());
+        }
+
+        if (align & Qt::AlignTop) {
+            position.setY(0);
+        } else if (align & Qt::AlignVCenter) {
+            position.setY((result.m_size.height() - size.height()) / 2);
+        } else if (align & Qt::AlignBottom) {
+            position.setY(result.m_size.height() - size.height());
+        }
+
+        if (stretch & Qt::Horizontal) {
+            position.setX(0);
+            size.setWidth(result.m_size.width());
+        }
+        if (stretch & Qt::Vertical) {
+            position.setY(0);
+            size.setHeight(result.m_size.height());
+        }
+
+        // Flatten the layers of the blended image into this one, so that
+        // rasterizing never needs intermediate images.
+        const auto xScale = image.m_size.width() > 0 ? size.width() / image.m_size.width() : 1.0;
+        const auto yScale = image.m_size.height() > 0 ? size.height() / image.m_size.height() : 1.0;
+        for (const auto &layer : image.m_layers) {
+            result.m_layers.append(Layer{
+                layer.renderer,
+                layer.element,
+                QRectF(position.x() + layer.rect.x() * xScale, position.y() + layer.rect.y() * yScale, layer.rect.width() * xScale, layer.rect.height() * yScale),
+            });
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <memory>
+
+#include <QImage>
+#include <QList>
+#include <QMetaType>
+
+class PlasmaSvgRenderer;
+
+/**
+ * An image made of one or more SVG elements that is rasterized on demand.
+ *
+ * Loading only determines which elements make up the image and where they are
+ * placed. Pixels are only produced once image() is called with the size and
+ * device pixel ratio the image is actually drawn at, using PlasmaSvgAtlas so
+ * that identical requests share the same pixels.
+ */
+class PlasmaSvgImage
+{
+public:
+    PlasmaSvgImage() = default;
+
+    bool isNull() const;
+
+    /**
+     * The natural size of the image, in logical pixels.
+     */
+    QSizeF size() const;
+
+    /**
+     * Rasterize the image at size, in logical pixels, for devicePixelRatio.
+     */
+    QImage image(const QSizeF &size, qreal devicePixelRatio = 1.0) const;
+
+    /**
+     * Rasterize the image at its natural size.
+     */
+    QImage image() const;
+
+    static PlasmaSvgImage fromElement(const std::shared_ptr<PlasmaSvgRenderer> &renderer, const QString &element);
+    static PlasmaSvgImage blend(const QList<PlasmaSvgImage> &images, Qt::Alignment align, Qt::Orientations stretch);
+
+private:
+    struct Layer {
+        std::shared_ptr<PlasmaSvgRenderer> renderer;
+        QString element;
+        // Where the element is placed, relative to the natural size.
+        QRectF rect;
+    };
+
+    QList<Layer> m_layers;
+    QSizeF m_size;
+};
+
+Q_DECLARE_METATYPE(PlasmaSvgImage)
@@ -19,6 +19,8 @@
 #include <Theme.h>
 
 #include "LoadingContext.h"
+#include "PlasmaSvgAtlas.h"
+#include "PlasmaSvgImage.h"
 #include "PlasmaSvgRenderer.h"
 #include "PropertyFunctions.h"
 
@@ -76,6 +78,11 @@ bool PlasmaSvgLoader::load(Theme::Ptr theme)
     ryml::EventHandlerTree eventHandler;
     ryml::Parser parser{&eventHandler, options};
 
+    // Loading is also used to pick up color scheme changes, so anything
+    // rasterized before may be stale.
+    PlasmaSvgAtlas::instance()->clear();
+    PlasmaSvgRenderer::clearStylesheets();
+
     std::string globalData;
     QFile globalDefinitions(dir.absoluteFilePath(u"global.inc.yml"_s));
     if (globalDefinitions.open(QFile::ReadOnly)) {
@@ -115,7 +122,9 @@ bool PlasmaSvgLoader::load(Theme::Ptr theme)
         createStyles(root, context);
     }
 
-    PlasmaSvgRenderer::clearRenderers(theme);
+    const auto statistics = PlasmaSvgRenderer::statistics();
+    qCDebug(UNION_PLASMASVG) << "Renderer cache:" << statistics.hits << "hits," << statistics.misses << "misses," << statistics.documentLoads
+                             << "documents loaded";
 
     return true;
 }
@@ -543,15 +552,17 @@ std::optional<ImageProperty> PlasmaSvgLoader::createImageProperty(ryml::ConstNod
 
     auto cleanup = context.pushFromNode(node, "image");
 
-    auto data = readPropertyValue<QImage>("imageData", node, context);
-    if (!data.has_value()) {
+    auto data = readPropertyValue<PlasmaSvgImage>("imageData", node, context);
+    if (!data.has_value() || data.value().isNull()) {
         return std::nullopt;
     }
 
+    // The image is only rasterized once the output requests it at a concrete
+    // size, so use the natural size of the elements here.
     ImageProperty image;
     image.setImageData(data.value());
-    image.setWidth(data.value().width());
-    image.setHeight(data.value().height());
+    image.setWidth(data.value().size().width());
+    image.setHeight(data.value().size().height());
     image.setFlags(Union::Properties::ImageFlag::RepeatBoth);
     return image;
 }
@@ -5,6 +5,7 @@
 
 #include <Theme.h>
 
+#include "PlasmaSvgImage.h"
 #include "PlasmaSvgLoader.h"
 
 using namespace Qt::StringLiterals;
@@ -12,6 +13,12 @@ using namespace Qt::StringLiterals;
 PlasmaSvgPlugin::PlasmaSvgPlugin(QObject *parent)
     : Union::InputPlugin(parent)
 {
+    // Allow consumers that expect a QImage to use image properties, which
+    // rasterizes the image at its natural size.
+    static const bool converterRegistered = QMetaType::registerConverter<PlasmaSvgImage, QImage>([](const PlasmaSvgImage &image) {
+        return image.image();
+    });
+    Q_UNUSED(converterRegistered)
 }
 
 std::shared_ptr<Union::Theme> PlasmaSvgPlugin::createTheme(const QString &themeName) const
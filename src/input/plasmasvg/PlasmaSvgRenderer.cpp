@@ -3,23 +3,145 @@
 
 #include "PlasmaSvgRenderer.h"
 
+#include <atomic>
+
 #include <QBuffer>
+#include <QDateTime>
 #include <QFile>
+#include <QFileInfo>
+#include <QMutex>
 #include <QTransform>
 #include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 #include <KCompressionDevice>
 
+#include <LruCache.h>
+
 #include "PlasmaSvgLoader.h"
 
 #include "plasmasvg_logging.h"
 
 using namespace Qt::StringLiterals;
 
-std::size_t qHash(const PlasmaSvgRenderer::RendererId &renderer, std::size_t seed)
+// Number of renderers to keep. Each renderer holds a parsed SVG document, so
+// this is kept fairly small.
+static constexpr std::size_t MaxRenderers = 64;
+// Number of SVG documents to keep in memory, in their unparsed form.
+static constexpr std::size_t MaxDocuments = 128;
+
+// Placeholder for the color scheme stylesheet in a document template.
+static constexpr QByteArrayView StylesheetPlaceholder = "@union-color-scheme@";
+
+// An SVG document that has been read from disk and prepared so that a
+// stylesheet can be inserted without having to process the XML again.
+struct SvgDocument {
+    // Everything up to the contents of the "current-color-scheme" style
+    // element, or the whole document if there is no such element.
+    QByteArray head;
+    // Everything after the contents of the style element.
+    QByteArray tail;
+    // Whether the document has a "current-color-scheme" style element and thus
+    // depends on the colors used.
+    bool recolorable = false;
+    // The modification time of the file when it was read.
+    QDateTime modified;
+};
+
+static QRecursiveMutex s_mutex;
+static Union::LruCache<std::size_t, std::shared_ptr<PlasmaSvgRenderer>, MaxRenderers> s_rendererCache;
+static Union::LruCache<std::size_t, std::shared_ptr<SvgDocument>, MaxDocuments> s_documentCache;
+static QHash<std::pair<QPalette::ColorGroup, KColorScheme::ColorSet>, QString> s_stylesheetCache;
+static PlasmaSvgRenderer::Statistics s_statistics;
+
+static std::shared_ptr<SvgDocument> readDocument(const QString &fileName)
 {
-    return qHashMulti(seed, renderer.theme, renderer.path, renderer.colorGroup, renderer.colorSet);
+    KCompressionDevice file(fileName, KCompressionDevice::GZip);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(UNION_PLASMASVG) << "Could not open SVG for rendering" << fileName;
+        return nullptr;
+    }
+
+    auto data = file.readAll();
+
+    QByteArray styledData;
+    styledData.reserve(data.size());
+
+    QXmlStreamReader xmlReader(data);
+    QBuffer buffer(&styledData);
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter xmlWriter(&buffer);
+
+    bool recolorable = false;
+    while (!xmlReader.atEnd()) {
+        auto next = xmlReader.readNext();
+
+        if (next == QXmlStreamReader::Invalid) {
+            continue;
+        }
+
+        auto guard = qScopeGuard([&]() {
+            xmlWriter.writeCurrentToken(xmlReader);
+        });
+
+        if (next != QXmlStreamReader::StartElement) {
+            continue;
+        }
+
+        if (xmlReader.qualifiedName() != u"style") {
+            continue;
+        }
+
+        if (xmlReader.attributes().value(u"id") != u"current-color-scheme") {
+            continue;
+        }
+
+        guard.dismiss();
+
+        xmlWriter.writeStartElement(u"style");
+        xmlWriter.writeAttributes(xmlReader.attributes());
+        xmlWriter.writeCharacters(QString::fromLatin1(StylesheetPlaceholder));
+        xmlWriter.writeEndElement();
+        recolorable = true;
+
+        while (xmlReader.tokenType() != QXmlStreamReader::EndElement) {
+            xmlReader.readNext();
+        }
+    }
+    buffer.close();
+
+    auto document = std::make_shared<SvgDocument>();
+
+    const auto index = recolorable ? styledData.indexOf(StylesheetPlaceholder) : -1;
+    if (index >= 0) {
+        document->head = styledData.left(index);
+        document->tail = styledData.mid(index + StylesheetPlaceholder.size());
+        document->recolorable = true;
+    } else {
+        // Nothing to replace, so use the original data as-is.
+        document->head = data;
+    }
+
+    return document;
+}
+
+static std::shared_ptr<SvgDocument> documentForPath(const QString &fileName)
+{
+    // Documents are identified by their modification time as well, so a file
+    // that changed on disk is read again instead of using the cached copy.
+    const auto modified = QFileInfo(fileName).lastModified();
+    const auto key = qHashMulti(QHashSeed::globalSeed(), fileName, modified);
+    if (auto document = s_documentCache.value(key)) {
+        return document.value();
+    }
+
+    auto document = readDocument(fileName);
+    if (document) {
+        document->modified = modified;
+        s_statistics.documentLoads++;
+        s_documentCache.insert(key, document);
+    }
+    return document;
 }
 
 struct ColorInfo {
@@ -31,6 +153,13 @@ struct ColorInfo {
 
 PlasmaSvgRenderer::PlasmaSvgRenderer()
 {
+    static std::atomic<quint64> nextId = 0;
+    m_id = ++nextId;
+}
+
+quint64 PlasmaSvgRenderer::id() const
+{
+    return m_id;
 }
 
 QPalette::ColorGroup PlasmaSvgRenderer::colorGroup() const
@@ -81,61 +210,20 @@ bool PlasmaSvgRenderer::load()
         return false;
     }
 
-    KCompressionDevice file(m_path, KCompressionDevice::GZip);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qCWarning(UNION_PLASMASVG) << "Could not open SVG for rendering" << m_path;
+    QMutexLocker locker(&s_mutex);
+
+    auto document = documentForPath(m_path);
+    if (!document) {
         return false;
     }
 
-    auto styleSheet = createStylesheet();
-
-    auto data = file.readAll();
-    auto styledData = QByteArray(data.size(), 0);
-
-    QXmlStreamReader xmlReader(data);
-    QBuffer buffer(&styledData);
-    buffer.open(QIODevice::WriteOnly);
-    QXmlStreamWriter xmlWriter(&buffer);
-
-    while (!xmlReader.atEnd()) {
-        auto next = xmlReader.readNext();
-
-        if (next == QXmlStreamReader::Invalid) {
-            continue;
-        }
-
-        auto guard = qScopeGuard([&]() {
-            xmlWriter.writeCurrentToken(xmlReader);
-        });
-
-        if (next != QXmlStreamReader::StartElement) {
-            continue;
-        }
-
-        if (xmlReader.qualifiedName() != u"style") {
-            continue;
-        }
-
-        if (xmlReader.attributes().value(u"id") != u"current-color-scheme") {
-            continue;
-        }
-
-        guard.dismiss();
-
-        xmlWriter.writeStartElement(u"style");
-        xmlWriter.writeAttributes(xmlReader.attributes());
-        xmlWriter.writeCharacters(styleSheet);
-        xmlWriter.writeEndElement();
-
-        while (xmlReader.tokenType() != QXmlStreamReader::EndElement) {
-            xmlReader.readNext();
-        }
+    if (document->recolorable) {
+        m_renderer = std::make_unique<QSvgRenderer>(document->head + stylesheet(m_colorGroup, m_colorSet).toUtf8() + document->tail);
+    } else {
+        m_renderer = std::make_unique<QSvgRenderer>(document->head);
     }
-    buffer.close();
 
-    m_renderer = std::make_unique<QSvgRenderer>(styledData);
-
-    return true;
+    return m_renderer->isValid();
 }
 
 bool PlasmaSvgRenderer::elementExists(const QString &elementName)
@@ -176,40 +264,77 @@ std::shared_ptr<PlasmaSvgRenderer> PlasmaSvgRenderer::rendererForPath(const std:
         colorSet = Union::Element::ColorSet::Window;
     }
 
-    RendererId id{theme.get(), pathString, colorGroup, colorSet};
-
-    if (s_rendererCache.contains(id)) {
-        return s_rendererCache.value(id);
-    }
-
     auto loader = static_cast<PlasmaSvgLoader *>(theme->loader());
     const auto fileName = loader->plasmaTheme()->imagePath(pathString);
     if (fileName.isEmpty()) {
         return nullptr;
     }
 
+    const auto kColorSet = static_cast<KColorScheme::ColorSet>(static_cast<int>(colorSet) - 1);
+
+    QMutexLocker locker(&s_mutex);
+
+    auto document = documentForPath(fileName);
+    if (!document) {
+        return nullptr;
+    }
+
+    // Renderers are identified by the stylesheet rather than the colors that
+    // were requested, so color sets that end up with the same colors share a
+    // renderer and a changed color scheme never returns a stale renderer. The
+    // same goes for the modification time of the document.
+    const auto styleSheet = document->recolorable ? stylesheet(colorGroup, kColorSet) : QString{};
+    const auto key = qHashMulti(QHashSeed::globalSeed(), fileName, document->modified, styleSheet);
+
+    if (auto cached = s_rendererCache.value(key)) {
+        s_statistics.hits++;
+        return cached.value();
+    }
+
+    s_statistics.misses++;
+
     auto renderer = std::make_shared<PlasmaSvgRenderer>();
     renderer->setPath(fileName);
     renderer->setColorGroup(colorGroup);
-    renderer->setColorSet(static_cast<KColorScheme::ColorSet>(static_cast<int>(colorSet) - 1));
+    renderer->setColorSet(kColorSet);
 
     if (!renderer->load()) {
         qCWarning(UNION_PLASMASVG) << "Renderer for path" << pathString << "failed to load";
         return nullptr;
     }
 
-    s_rendererCache.insert(id, renderer);
+    s_rendererCache.insert(key, renderer);
     return renderer;
 }
 
-void PlasmaSvgRenderer::clearRenderers(const std::shared_ptr<Union::Theme> &theme)
+void PlasmaSvgRenderer::clearStylesheets()
+{
+    QMutexLocker locker(&s_mutex);
+    s_stylesheetCache.clear();
+}
+
+PlasmaSvgRenderer::Statistics PlasmaSvgRenderer::statistics()
+{
+    QMutexLocker locker(&s_mutex);
+    return s_statistics;
+}
+
+QString PlasmaSvgRenderer::stylesheet(QPalette::ColorGroup colorGroup, KColorScheme::ColorSet colorSet)
 {
-    s_rendererCache.removeIf([&theme](auto itr) {
-        return itr.key().theme == theme.get();
-    });
+    QMutexLocker locker(&s_mutex);
+
+    const auto key = std::make_pair(colorGroup, colorSet);
+    auto itr = s_stylesheetCache.constFind(key);
+    if (itr != s_stylesheetCache.constEnd()) {
+        return itr.value();
+    }
+
+    auto result = createStylesheet(colorGroup, colorSet);
+    s_stylesheetCache.insert(key, result);
+    return result;
 }
 
-QString PlasmaSvgRenderer::createStylesheet()
+QString PlasmaSvgRenderer::createStylesheet(QPalette::ColorGroup colorGroup, KColorScheme::ColorSet colorSet)
 {
     QString stylesheet;
 
@@ -270,7 +395,7 @@ QString PlasmaSvgRenderer::createStylesheet()
 
     const QString styleTemplate = QStringLiteral(".ColorScheme-%1{color:%2;}");
 
-    KColorScheme colorScheme{m_colorGroup, m_colorSet};
+    KColorScheme colorScheme{colorGroup, colorSet};
     QColor color;
 
     for (const auto &info : colors) {
@@ -16,20 +16,27 @@
 class PlasmaSvgRenderer
 {
 public:
-    struct RendererId {
-        Union::Theme *theme;
-        QString path;
-        QPalette::ColorGroup colorGroup;
-        Union::Element::ColorSet colorSet;
-
-        inline bool operator==(const RendererId &other) const
-        {
-            return path == other.path && colorGroup == other.colorGroup && colorSet == other.colorSet;
-        }
+    /**
+     * Counters for the renderer cache, intended for debugging.
+     */
+    struct Statistics {
+        // Renderer requests that were served from the cache.
+        quint64 hits = 0;
+        // Renderer requests that needed a new renderer.
+        quint64 misses = 0;
+        // SVG files that were read from disk.
+        quint64 documentLoads = 0;
     };
 
     PlasmaSvgRenderer();
 
+    /**
+     * A number that uniquely identifies this renderer within the process.
+     *
+     * Unlike the address of the renderer, this is never reused.
+     */
+    quint64 id() const;
+
     QPalette::ColorGroup colorGroup() const;
     void setColorGroup(QPalette::ColorGroup group);
 
@@ -45,19 +52,35 @@ public:
     QRectF elementRect(const QString &elementName);
     void render(QPainter *painter, const QString &elementName, const QRectF &bounds = QRectF{});
 
+    /**
+     * Returns a renderer for path using the colors of colorGroup and colorSet.
+     *
+     * Renderers are shared by everything that ends up with the same colors,
+     * and SVGs that do not use the color scheme share a single renderer. Up to
+     * a fixed number of renderers is kept, so switching back and forth between
+     * palettes does not parse the SVG again.
+     */
     static std::shared_ptr<PlasmaSvgRenderer> rendererForPath(const std::shared_ptr<Union::Theme> &theme, //
                                                               QAnyStringView path,
                                                               QPalette::ColorGroup colorGroup,
                                                               Union::Element::ColorSet colorSet);
-    static void clearRenderers(const std::shared_ptr<Union::Theme> &theme);
+
+    /**
+     * Forget the stylesheets created from the color scheme.
+     *
+     * This should be called when the color scheme may have changed.
+     */
+    static void clearStylesheets();
+
+    static Statistics statistics();
 
 private:
-    QString createStylesheet();
+    static QString stylesheet(QPalette::ColorGroup colorGroup, KColorScheme::ColorSet colorSet);
+    static QString createStylesheet(QPalette::ColorGroup colorGroup, KColorScheme::ColorSet colorSet);
 
+    quint64 m_id = 0;
     QPalette::ColorGroup m_colorGroup = QPalette::Normal;
     KColorScheme::ColorSet m_colorSet = KColorScheme::ColorSet::Window;
     QString m_path;
     std::unique_ptr<QSvgRenderer> m_renderer;
-
-    inline static QHash<RendererId, std::shared_ptr<PlasmaSvgRenderer>> s_rendererCache;
 };
@@ -3,7 +3,6 @@
 
 #include "PropertyFunctions.h"
 
-#include <QPainter>
 #include <QVariant>
 
 #include <KConfigGroup>
@@ -63,14 +62,8 @@ PropertyFunctionResult PropertyFunctions::elementImage(ryml::ConstNodeRef node,
         return Error{u"Could not find element " + element};
     }
 
-    auto size = renderer->elementRect(element).size();
-
-    QImage image(size.toSize(), QImage::Format_ARGB32);
-    image.fill(Qt::transparent);
-    QPainter painter(&image);
-    renderer->render(&painter, element);
-
-    return image;
+    // Rasterization is deferred until the image is drawn, see PlasmaSvgImage.
+    return QVariant::fromValue(PlasmaSvgImage::fromElement(renderer, element));
 }
 
 PropertyFunctionResult PropertyFunctions::elementImageBlend(ryml::ConstNodeRef node, LoadingContext &context)
@@ -84,9 +77,7 @@ PropertyFunctionResult PropertyFunctions::elementImageBlend(ryml::ConstNodeRef n
         return Error("Key 'elements' is empty");
     }
 
-    QList<QImage> images;
-    int maxWidth = 0;
-    int maxHeight = 0;
+    QList<PlasmaSvgImage> images;
     for (auto child : elementsNode.children()) {
         if (child.has_val()) {
             context.data.elementNames.push(value<QString>(child));
@@ -94,20 +85,14 @@ PropertyFunctionResult PropertyFunctions::elementImageBlend(ryml::ConstNodeRef n
             context.data.elementNames.pop();
 
             if (image.has_value()) {
-                auto imageValue = image.value<QImage>();
-                images.append(imageValue);
-                maxWidth = std::max(maxWidth, imageValue.width());
-                maxHeight = std::max(maxHeight, imageValue.height());
+                images.append(image.value<PlasmaSvgImage>());
             } else {
                 return image.error();
             }
         } else if (child.is_map()) {
-            auto value = elementProperty<QImage>(child, context);
+            auto value = elementProperty<PlasmaSvgImage>(child, context);
             if (value.has_value()) {
-                auto imageValue = value.value();
-                images.append(imageValue);
-                maxWidth = std::max(maxWidth, imageValue.width());
-                maxHeight = std::max(maxHeight, imageValue.height());
+                images.append(value.value());
             } else {
                 return value.error();
             }
@@ -124,42 +109,7 @@ PropertyFunctionResult PropertyFunctions::elementImageBlend(ryml::ConstNodeRef n
         stretch = value<Qt::Orientations>(node);
     });
 
-    QImage result(maxWidth, maxHeight, QImage::Format_ARGB32);
-    result.fill(Qt::transparent);
-
-    QPainter painter(&result);
-    for (const auto &image : images) {
-        QPoint position;
-        QSize size = image.size();
-        if (align & Qt::AlignLeft) {
-            position.setX(0);
-        } else if (align & Qt::AlignHCenter) {
-            position.setX((maxWidth - image.width()) / 2);
-        } else if (align & Qt::AlignRight) {
-            position.setX(maxWidth - image.width());
-        }
-
-        if (align & Qt::AlignTop) {
-            position.setY(0);
-        } else if (align & Qt::AlignVCenter) {
-            position.setY((maxHeight - image.height()) / 2);
-        } else if (align & Qt::AlignBottom) {
-            position.setY(maxHeight - image.height());
-        }
-
-        if (stretch & Qt::Horizontal) {
-            position.setX(0);
-            size.setWidth(maxWidth);
-        }
-        if (stretch & Qt::Vertical) {
-            position.setY(0);
-            size.setHeight(maxHeight);
-        }
-
-        painter.drawImage(QRect(position, size), image);
-    }
-
-    return result;
+    return QVariant::fromValue(PlasmaSvgImage::blend(images, align, stretch));
 }
 
 PropertyFunctionResult PropertyFunctions::sum(ryml::ConstNodeRef node, LoadingContext &context)
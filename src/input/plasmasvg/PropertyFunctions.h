@@ -10,6 +10,7 @@
 #include <ryml.hpp>
 
 #include "LoadingContext.h"
+#include "PlasmaSvgImage.h"
 #include "RYMLHelpers.h"
 
 namespace PropertyFunctions
@@ -121,6 +122,12 @@ inline Result<QImage> constantValue<QImage>(ryml::ConstNodeRef)
     return Error{"Constant values for QImage not supported"};
 }
 
+template<>
+inline Result<PlasmaSvgImage> constantValue<PlasmaSvgImage>(ryml::ConstNodeRef)
+{
+    return Error{"Constant values for images not supported"};
+}
+
 template<>
 inline Result<QSizeF> constantValue<QSizeF>(ryml::ConstNodeRef)
 {
@@ -7,9 +7,9 @@
 #include <QQuickRenderControl>
 #include <QSGImageNode>
 
-#include <StyleRegistry.h>
-
+#include "IconCache.h"
 #include "QuickStyle.h"
+#include "scenegraph/TextureCache.h"
 
 #include "qtquick_logging.h"
 
@@ -42,6 +42,21 @@ QSize iconSizeForSize(const QIcon &icon, const QSize &size)
     }
 }
 
+// Textures come from TextureCache and are shared with other items, so the node
+// needs to keep the texture alive while it is using it.
+class IconNode : public QSGNode
+{
+public:
+    IconNode(QSGImageNode *node)
+        : imageNode(node)
+    {
+        appendChildNode(imageNode);
+    }
+
+    QSGImageNode *imageNode;
+    std::shared_ptr<QSGTexture> texture;
+};
+
 Icon::Icon(QQuickItem *parent)
     : QQuickItem(parent)
 {
@@ -164,14 +179,16 @@ void Icon::resetControl()
 QSGNode *Icon::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *)
 {
     if (m_icon.isNull()) {
+        delete node;
         return nullptr;
     }
 
     if (!node) {
-        node = window()->createImageNode();
+        node = new IconNode(window()->createImageNode());
     }
 
-    auto imageNode = static_cast<QSGImageNode *>(node);
+    auto iconNode = static_cast<IconNode *>(node);
+    auto imageNode = iconNode->imageNode;
 
     auto bounds = boundingRect();
 
@@ -179,7 +196,7 @@ QSGNode *Icon::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *)
                               std::round(bounds.y() + (bounds.height() - m_iconSize.height()) / 2.0),
                               qreal(m_iconSize.width()),
                               qreal(m_iconSize.height())});
-    imageNode->setOwnsTexture(true);
+    imageNode->setOwnsTexture(false);
 
     if (smooth()) {
         imageNode->setFiltering(QSGTexture::Linear);
@@ -196,9 +213,22 @@ QSGNode *Icon::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *)
 
     if (m_iconChanged || !imageNode->texture() || !qFuzzyCompare(m_iconDpr, dpr)) {
         const auto mode = isEnabled() ? QIcon::Mode::Normal : QIcon::Mode::Disabled;
-        auto image = m_icon.pixmap(m_iconSize, dpr, mode).toImage();
-        imageNode->setTexture(window()->createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas));
+        // Identical icons share the same image, and therefore the same texture.
+        auto image = IconCache::instance()->image(m_icon, m_iconSize, dpr, mode);
+        // Icons are small enough to be put in the texture atlas, so they can be
+        // batched with other icons and border images.
+        auto texture = TextureCache::loadTexture(window(), image, QQuickWindow::TextureCanUseAtlas);
+        if (!texture) {
+            // Rather than keep showing the previous icon, show nothing. The
+            // next update starts over with a new node.
+            delete node;
+            return nullptr;
+        }
+
+        imageNode->setTexture(texture.get());
+        iconNode->texture = texture;
         m_iconChanged = false;
+        m_iconDpr = dpr;
     }
 
     return node;
@@ -234,11 +264,7 @@ void Icon::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
 
 void Icon::updatePolish()
 {
-    if (!m_source.isEmpty() && m_source.isLocalFile()) {
-        m_icon = QIcon(m_source.toLocalFile());
-    } else {
-        m_icon = Union::StyleRegistry::instance()->platform()->platformIcon(m_name, m_color);
-    }
+    m_icon = IconCache::instance()->icon(m_name, m_source, m_color);
 
     m_iconSize = iconSizeForSize(m_icon, boundingRect().size().toSize());
     m_iconChanged = true;
@@ -271,8 +297,8 @@ void Icon::onControlIconChanged()
     if ((width <= 0 || height <= 0) && m_style->query()) {
         auto properties = m_style->query()->properties();
         if (properties && properties->icon()) {
-            width = properties->icon()->width().value_or(0.0);
-            height = properties->icon()->height().value_or(0.0);
+            width = properties->icon()->width().value_or(0.0).toPixels();
+            height = properties->icon()->height().value_or(0.0).toPixels();
         }
     }
 
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "IconCache.h"
+
+#include <QGuiApplication>
+
+#include <StyleRegistry.h>
+
+#include "qtquick_logging.h"
+
+using namespace Union::Quick;
+
+IconCache::IconCache()
+{
+    m_themeName = QIcon::themeName();
+    // Palette changes affect the colors of recolored icons.
+    connect(qGuiApp, &QGuiApplication::paletteChanged, this, &IconCache::clear);
+}
+
+QIcon IconCache::icon(const QString &name, const QUrl &source, const QColor &color)
+{
+    QMutexLocker locker(&m_mutex);
+    checkThemeLocked();
+
+    const auto key = IconKey{name, source, color.rgba()};
+    if (auto icon = m_icons.value(key)) {
+        m_statistics.iconHits++;
+        return icon.value();
+    }
+
+    m_statistics.iconMisses++;
+
+    QIcon icon;
+    if (!source.isEmpty() && source.isLocalFile()) {
+        icon = QIcon(source.toLocalFile());
+    } else {
+        icon = Union::StyleRegistry::instance()->platform()->platformIcon(name, color);
+    }
+
+    m_icons.insert(key, icon);
+    return icon;
+}
+
+QImage IconCache::image(const QIcon &icon, const QSize &size, qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state)
+{
+    if (icon.isNull() || size.isEmpty()) {
+        return QImage{};
+    }
+
+    QMutexLocker locker(&m_mutex);
+    checkThemeLocked();
+
+    // Icons returned by icon() are shared, so identical icons have the same
+    // cache key.
+    const auto key = ImageKey{icon.cacheKey(), size, devicePixelRatio, mode, state};
+    if (auto image = m_images.value(key)) {
+        m_statistics.imageHits++;
+        return image.value();
+    }
+
+    m_statistics.imageMisses++;
+
+    auto image = icon.pixmap(size, devicePixelRatio, mode, state).toImage();
+    m_images.insert(key, image);
+    return image;
+}
+
+void IconCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    clearLocked();
+}
+
+IconCache::Statistics IconCache::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_statistics;
+}
+
+std::shared_ptr<IconCache> IconCache::instance()
+{
+    static std::shared_ptr<IconCache> inst = std::make_shared<IconCache>();
+    return inst;
+}
+
+std::size_t IconCache::IconKeyHash::operator()(const IconKey &key) const
+{
+    return qHashMulti(QHashSeed::globalSeed(), key.name, key.source, key.color);
+}
+
+std::size_t IconCache::ImageKeyHash::operator()(const ImageKey &key) const
+{
+    return qHashMulti(QHashSeed::globalSeed(), key.icon, key.size.width(), key.size.height(), key.devicePixelRatio, int(key.mode), int(key.state));
+}
+
+void IconCache::checkThemeLocked()
+{
+    // Icon theme changes are not announced by a signal, so check for them
+    // whenever the cache is used. Images are rendered on the render thread
+    // and may be requested before the item had a chance to request its icon
+    // again, so this is needed for both icons and images.
+    const auto themeName = QIcon::themeName();
+    if (themeName != m_themeName) {
+        m_themeName = themeName;
+        clearLocked();
+    }
+}
+
+void IconCache::clearLocked()
+{
+    qCDebug(UNION_QTQUICK) << "Clearing icon cache, icon hits:" << m_statistics.iconHits << "misses:" << m_statistics.iconMisses
+                           << "image hits:" << m_statistics.imageHits << "misses:" << m_statistics.imageMisses;
+
+    m_icons.clear();
+    m_images.clear();
+}
+
+#include "moc_IconCache.cpp"
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <QIcon>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QUrl>
+
+#include <LruCache.h>
+
+namespace Union
+{
+namespace Quick
+{
+
+/*!
+ * A process-wide cache of icons and their rasterized images.
+ *
+ * Looking up an icon through the platform plugin and rasterizing it can be
+ * expensive, and the same icon is often used by many items, for example in
+ * every delegate of a list. This caches both the icons, by name or source and
+ * color, as well as the images created from them, by icon, size, device pixel
+ * ratio, mode and state. Since the same image is returned for identical
+ * requests, TextureCache will also share the texture created from it for each
+ * window.
+ *
+ * The cache is cleared when the application palette or icon theme changes.
+ */
+class IconCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Statistics {
+        quint64 iconHits = 0;
+        quint64 iconMisses = 0;
+        quint64 imageHits = 0;
+        quint64 imageMisses = 0;
+    };
+
+    IconCache();
+
+    /*!
+     * Returns the icon for \p name, tinted with \p color.
+     *
+     * If \p source is a local file, the icon is loaded from that file instead.
+     */
+    QIcon icon(const QString &name, const QUrl &source, const QColor &color);
+
+    /*!
+     * Returns an image of \p icon.
+     *
+     * The image is rasterized at \p size for \p devicePixelRatio using \p mode
+     * and \p state. Images are cached by the cache key of \p icon, so this
+     * should be an icon returned by icon().
+     */
+    QImage image(const QIcon &icon, const QSize &size, qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state = QIcon::Off);
+
+    /*!
+     * Remove all icons and images from the cache.
+     */
+    void clear();
+
+    /*!
+     * Returns the number of cache hits and misses since the cache was created.
+     */
+    Statistics statistics() const;
+
+    static std::shared_ptr<IconCache> instance();
+
+private:
+    struct IconKey {
+        QString name;
+        QUrl source;
+        QRgb color = 0;
+
+        bool operator==(const IconKey &other) const = default;
+    };
+
+    struct IconKeyHash {
+        std::size_t operator()(const IconKey &key) const;
+    };
+
+    struct ImageKey {
+        qint64 icon = 0;
+        QSize size;
+        qreal devicePixelRatio = 1.0;
+        QIcon::Mode mode = QIcon::Normal;
+        QIcon::State state = QIcon::Off;
+
+        bool operator==(const ImageKey &other) const = default;
+    };
+
+    struct ImageKeyHash {
+        std::size_t operator()(const ImageKey &key) const;
+    };
+
+    void checkThemeLocked();
+    void clearLocked();
+
+    // Guards all members below, as images are requested from the render thread.
+    mutable QMutex m_mutex;
+    QString m_themeName;
+    Union::LruCache<IconKey, QIcon, 256, IconKeyHash> m_icons;
+    Union::LruCache<ImageKey, QImage, 512, ImageKeyHash> m_images;
+    Statistics m_statistics;
+};
+
+}
+}
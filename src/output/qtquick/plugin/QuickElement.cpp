@@ -6,6 +6,7 @@
 #include <QCoreApplication>
 #include <QQmlEngine>
 #include <QQuickItem>
+#include <QSet>
 
 #include "Element.h"
 #include "EventHelper.h"
@@ -22,6 +23,76 @@ using namespace Union::Quick;
 UNIONQUICKIMPL_EXPORT QEvent::Type QuickElementUpdatedEvent::s_type = QEvent::None;
 static EventTypeRegistration<QuickElementUpdatedEvent> quickElementRegistration;
 
+namespace Union::Quick
+{
+// Forwards StyleChangedEvent from a style to all elements using that style.
+//
+// A style is shared by all elements, so rather than having each element
+// install an event filter on the style, which makes installing a filter and
+// delivering any event to the style scale with the number of elements, a
+// single dispatcher is installed that tracks the elements.
+class StyleChangeDispatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    StyleChangeDispatcher(Style *style)
+        : QObject(style)
+    {
+        style->installEventFilter(this);
+    }
+
+    // Returns the dispatcher for style, or nullptr if there is none.
+    static StyleChangeDispatcher *find(Style *style)
+    {
+        return style->findChild<StyleChangeDispatcher *>(QString{}, Qt::FindDirectChildrenOnly);
+    }
+
+    // Returns the dispatcher for style, creating it if needed.
+    static StyleChangeDispatcher *forStyle(Style *style)
+    {
+        auto dispatcher = find(style);
+        if (!dispatcher) {
+            dispatcher = new StyleChangeDispatcher(style);
+        }
+        return dispatcher;
+    }
+
+    void add(QuickElement *element)
+    {
+        m_elements.insert(element);
+    }
+
+    void remove(QuickElement *element)
+    {
+        m_elements.remove(element);
+    }
+
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        if (event->type() != StyleChangedEvent::s_type) {
+            return QObject::eventFilter(watched, event);
+        }
+
+        auto changeEvent = static_cast<StyleChangedEvent *>(event);
+
+        // Updating an element may end up destroying other elements, so only
+        // dispatch to elements that are still alive.
+        const auto elements = m_elements.values();
+        for (auto element : elements) {
+            if (m_elements.contains(element)) {
+                element->styleChanged(changeEvent);
+            }
+        }
+
+        return false;
+    }
+
+private:
+    QSet<QuickElement *> m_elements;
+};
+}
+
 template<typename T, QList<T *> QuickElement::*member, void (QuickElement::*changeSignal)()>
 struct ListFunctions {
     static void append(QQmlListProperty<T> *property, T *value)
@@ -301,12 +372,24 @@ QuickElement::QuickElement(QObject *parent)
 
     m_statesGroup = std::make_unique<StatesGroup>(this);
     m_style = StyleRegistry::instance()->defaultStyle();
+    if (m_style) {
+        StyleChangeDispatcher::forStyle(m_style.get())->add(this);
+    }
 
     initialize();
 
     update();
 }
 
+QuickElement::~QuickElement()
+{
+    if (m_style) {
+        if (auto dispatcher = StyleChangeDispatcher::find(m_style.get())) {
+            dispatcher->remove(this);
+        }
+    }
+}
+
 QString QuickElement::type() const
 {
     return m_element->type();
@@ -363,6 +446,38 @@ QQmlListProperty<ElementAttribute> QuickElement::attributes()
                                               &AttributeFunctions::removeLast);
 }
 
+int QuickElement::index() const
+{
+    return m_index;
+}
+
+void QuickElement::setIndex(int newIndex)
+{
+    if (newIndex == m_index) {
+        return;
+    }
+
+    m_index = newIndex;
+    updatePosition();
+    Q_EMIT indexChanged();
+}
+
+int QuickElement::siblingCount() const
+{
+    return m_siblingCount;
+}
+
+void QuickElement::setSiblingCount(int newSiblingCount)
+{
+    if (newSiblingCount == m_siblingCount) {
+        return;
+    }
+
+    m_siblingCount = newSiblingCount;
+    updatePosition();
+    Q_EMIT siblingCountChanged();
+}
+
 StatesGroup *QuickElement::states() const
 {
     return m_statesGroup.get();
@@ -415,6 +530,23 @@ bool QuickElement::eventFilter(QObject *watched, QEvent *event)
     return QObject::eventFilter(watched, event);
 }
 
+void QuickElement::styleChanged(StyleChangedEvent *event)
+{
+    // When the rules of the style changed, only elements matching the changed
+    // rules need to be updated. Children are not updated here, they receive the
+    // same event and check for themselves.
+    if (!event->rulesChanged()) {
+        return;
+    }
+
+    // The rules may use different structural selectors now.
+    updatePosition();
+
+    if (m_query && event->affects(m_query->elements())) {
+        updateQuery();
+    }
+}
+
 void QuickElement::classBegin()
 {
 }
@@ -435,6 +567,7 @@ void QuickElement::componentComplete()
 
     updateHints();
     updateAttributes();
+    updatePosition();
     update();
 
     // It is possible that `QQuickAttachedPropertyPropagator::initialize()`
@@ -499,12 +632,35 @@ void QuickElement::updateAttributes()
     m_element->setAttributes(activeAttributes);
 }
 
+void QuickElement::updatePosition()
+{
+    if (!m_completed || !m_style) {
+        return;
+    }
+
+    // Only store the part of the position that matters to the style. When a
+    // delegate is inserted into a long list, this means only the siblings
+    // whose reduced position changed get updated, rather than all of them.
+    const auto [index, siblingCount] = m_style->siblingPosition(m_index, m_siblingCount);
+    m_element->setPosition(index, siblingCount);
+}
+
 void QuickElement::update()
 {
     if (!m_completed) {
         return;
     }
 
+    updateQuery();
+
+    const auto children = attachedChildren();
+    for (auto child : children) {
+        qobject_cast<QuickElement *>(child)->update();
+    }
+}
+
+void QuickElement::updateQuery()
+{
     m_query = std::make_unique<Union::ElementQuery>(m_style);
 
     QList<Element::Ptr> elements;
@@ -530,11 +686,6 @@ void QuickElement::update()
     QCoreApplication::sendEvent(this, &event);
 
     Q_EMIT updated();
-
-    const auto children = attachedChildren();
-    for (auto child : children) {
-        qobject_cast<QuickElement *>(child)->update();
-    }
 }
 
 QuickElementUpdatedEvent::QuickElementUpdatedEvent()
@@ -542,4 +693,6 @@ QuickElementUpdatedEvent::QuickElementUpdatedEvent()
 {
 }
 
+#include "QuickElement.moc"
+
 #include "moc_QuickElement.cpp"
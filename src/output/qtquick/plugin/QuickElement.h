@@ -18,10 +18,13 @@
 
 namespace Union
 {
+class StyleChangedEvent;
+
 namespace Quick
 {
 
 class QuickElement;
+class StyleChangeDispatcher;
 
 class StatesGroup : public QObject
 {
@@ -320,6 +323,7 @@ class UNIONQUICKIMPL_EXPORT QuickElement : public QQuickAttachedPropertyPropagat
 
 public:
     QuickElement(QObject *parent = nullptr);
+    ~QuickElement() override;
 
     /*!
      * \qmlattachedproperty Element Element::parentElement
@@ -406,6 +410,34 @@ public:
     QQmlListProperty<ElementAttribute> attributes();
     Q_SIGNAL void attributesChanged();
 
+    /*!
+     * \qmlattachedproperty int Element::index
+     *
+     * The index of the element among its siblings.
+     *
+     * This is used by structural selectors like \c{:first-child} and
+     * \c{:nth-child()}. For delegates of a view this would usually be set to
+     * the delegate's index. The default is -1, which means the position is
+     * unknown and structural selectors will not match.
+     */
+    Q_PROPERTY(int index READ index WRITE setIndex NOTIFY indexChanged)
+    int index() const;
+    void setIndex(int newIndex);
+    Q_SIGNAL void indexChanged();
+
+    /*!
+     * \qmlattachedproperty int Element::siblingCount
+     *
+     * The amount of siblings of the element, including the element itself.
+     *
+     * This is used by structural selectors like \c{:last-child}. For
+     * delegates of a view this would usually be set to the view's count.
+     */
+    Q_PROPERTY(int siblingCount READ siblingCount WRITE setSiblingCount NOTIFY siblingCountChanged)
+    int siblingCount() const;
+    void setSiblingCount(int newSiblingCount);
+    Q_SIGNAL void siblingCountChanged();
+
     /**
      * The query built from this element and its parents.
      */
@@ -439,11 +471,15 @@ private:
     friend class StatesGroup;
     friend class ElementHint;
     friend class ElementAttribute;
+    friend class StyleChangeDispatcher;
 
     void setActiveStates(Union::Element::States newActiveStates);
     void updateHints();
     void updateAttributes();
+    void updatePosition();
     void update();
+    void updateQuery();
+    void styleChanged(Union::StyleChangedEvent *event);
 
     std::shared_ptr<Union::Element> m_element;
     std::unique_ptr<StatesGroup> m_statesGroup;
@@ -451,6 +487,9 @@ private:
     QList<ElementHint *> m_hints;
     QList<ElementAttribute *> m_attributes;
 
+    int m_index = -1;
+    int m_siblingCount = 0;
+
     std::unique_ptr<Union::ElementQuery> m_query;
     std::shared_ptr<Union::Style> m_style;
 
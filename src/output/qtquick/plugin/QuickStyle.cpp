@@ -8,6 +8,7 @@
 
 #include <Element.h>
 #include <EventHelper.h>
+#include <Length.h>
 #include <Style.h>
 #include <StyleRule.h>
 
@@ -81,6 +82,16 @@ bool QuickStyle::eventFilter(QObject *watched, QEvent *event)
         // Send to self to allow event filtering on this instance to react to changes.
         QCoreApplication::sendEvent(this, &event);
 
+        // Lengths only need to be resolved again if the context used to
+        // resolve them changed.
+        if (m_lengthGeneration != Length::contextGeneration()) {
+            m_lengthGeneration = Length::contextGeneration();
+            m_properties->refreshLengths();
+
+            QuickStyleUpdatedEvent updatedEvent;
+            QCoreApplication::sendEvent(this, &updatedEvent);
+        }
+
         return false;
     }
 
@@ -132,6 +143,7 @@ void QuickStyle::update()
         return;
     }
 
+    m_lengthGeneration = Length::contextGeneration();
     m_properties->update(query->properties());
 
     QuickStyleUpdatedEvent event;
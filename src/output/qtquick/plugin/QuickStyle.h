@@ -96,6 +96,8 @@ private:
     std::unique_ptr<StylePropertyGroupQuick> m_properties;
     QPointer<QuickElement> m_element = nullptr;
     QQmlEngine *m_engine = nullptr;
+    // The Length context generation that was used to resolve lengths.
+    quint64 m_lengthGeneration = 0;
 };
 
 class QuickStyleUpdatedEvent : public QEvent
@@ -4,6 +4,7 @@
 #include "StyledRectangle.h"
 
 #include <QQuickWindow>
+#include <QSGRectangleNode>
 
 #include <properties/BackgroundPropertyGroup.h>
 #include <properties/LinePropertyGroup.h>
@@ -11,6 +12,7 @@
 
 #include "StyleRule.h"
 
+#include "scenegraph/NinePatchShadowNode.h"
 #include "scenegraph/OutlineBorderRectangleNode.h"
 #include "scenegraph/RectangleNode.h"
 #include "scenegraph/RectangleShadowNode.h"
@@ -20,6 +22,37 @@ using namespace Union::Properties;
 using namespace Union::Quick;
 using namespace Qt::StringLiterals;
 
+// A rectangle with an opaque background, square corners and nothing drawn
+// around or on top of it does not need any of the shader features. Drawing it
+// as a plain rectangle node allows the renderer to put it in its opaque batch,
+// which is drawn front to back without blending.
+static bool isOpaqueRectangle(const StylePropertyGroup *style, const QVector4D &radii)
+{
+    if (!radii.isNull()) {
+        return false;
+    }
+
+    if (auto shadow = style->shadow(); shadow && !shadow->isEmpty()) {
+        return false;
+    }
+
+    if (auto border = style->border(); border && !border->isEmpty()) {
+        return false;
+    }
+
+    if (auto outline = style->outline(); outline && !outline->isEmpty()) {
+        return false;
+    }
+
+    auto background = style->background();
+    if (!background || (background->image() && !background->image()->isEmpty())) {
+        return false;
+    }
+
+    auto color = background->color();
+    return color.has_value() && color->toQColor().alpha() == 255;
+}
+
 StyledRectangle::StyledRectangle(QQuickItem *parent)
     : QQuickItem(parent)
 {
@@ -113,7 +146,7 @@ void StyledRectangle::updateImplicitSize()
 
     if (query->properties()->layout()) {
         auto layout = query->properties()->layout();
-        setImplicitSize(layout->width().value_or(0.0), layout->height().value_or(0.0));
+        setImplicitSize(layout->width().value_or(0.0).toPixels(), layout->height().value_or(0.0).toPixels());
     }
 
     update();
@@ -132,6 +165,29 @@ QSGNode *StyledRectangle::updateShaderNode(QSGNode *node, const StylePropertyGro
     // Shader corner radius order is bottom right, top right, bottom left, top left.
     auto radii = QVector4D{float(cornerSizes.bottomRight), float(cornerSizes.topRight), float(cornerSizes.bottomLeft), float(cornerSizes.topLeft)};
 
+    const bool opaque = isOpaqueRectangle(style, radii);
+    if (opaque != m_opaque) {
+        // The opaque rectangle uses entirely different child nodes, so start
+        // from scratch when switching between the two.
+        while (auto child = node->firstChild()) {
+            node->removeChildNode(child);
+            delete child;
+        }
+        m_opaque = opaque;
+    }
+
+    if (opaque) {
+        if (node->childCount() == 0) {
+            node->appendChildNode(window()->createRectangleNode());
+        }
+
+        auto rectangleNode = static_cast<QSGRectangleNode *>(node->firstChild());
+        rectangleNode->setRect(rect);
+        rectangleNode->setColor(style->background()->color()->toQColor());
+
+        return node;
+    }
+
     OutlineBorderRectangleNode *borderNode = nullptr;
 
     // Render the shadow as a separate node, followed by the actual rectangle.
@@ -139,21 +195,49 @@ QSGNode *StyledRectangle::updateShaderNode(QSGNode *node, const StylePropertyGro
     // rectangle geometry and separating them into different nodes made the
     // whole thing a lot simpler.
     if (auto shadow = style->shadow(); shadow && !shadow->isEmpty()) {
+        const auto blur = float(shadow->blur().value_or(0.0).toPixels());
+        const auto spread = float(shadow->size().value_or(0.0).toPixels());
+
+        // Nine-patch shadows cannot render shadows whose corners would overlap,
+        // so this may switch between the two kinds of shadow node.
+        const bool ninePatch = NinePatchShadowNode::canRender(rect, radii, blur, spread);
+        if (node->childCount() > 1 && ninePatch != m_ninePatchShadow) {
+            auto shadowNode = node->firstChild();
+            node->removeChildNode(shadowNode);
+            delete shadowNode;
+        }
+        m_ninePatchShadow = ninePatch;
+
         if (node->childCount() == 0) {
-            node->appendChildNode(new RectangleShadowNode{});
             node->appendChildNode(new OutlineBorderRectangleNode{});
-        } else if (node->childCount() == 1) {
-            node->prependChildNode(new RectangleShadowNode{});
         }
 
-        auto shadowNode = static_cast<RectangleShadowNode *>(node->firstChild());
-        shadowNode->setItemRect(rect);
-        shadowNode->setRadius(radii);
-        shadowNode->setBlur(shadow->blur().value_or(0.0));
-        shadowNode->setSpread(shadow->size().value_or(0.0));
-        shadowNode->setOffset(shadow->offset() ? shadow->offset()->toVector2D() : QVector2D{});
-        shadowNode->setColor(shadow->color().value_or(Union::Color{}).toQColor());
-        shadowNode->update();
+        if (node->childCount() == 1) {
+            if (ninePatch) {
+                node->prependChildNode(new NinePatchShadowNode{window()});
+            } else {
+                node->prependChildNode(new RectangleShadowNode{});
+            }
+        }
+
+        auto updateShadow = [&](auto shadowNode) {
+            shadowNode->setItemRect(rect);
+            shadowNode->setRadius(radii);
+            shadowNode->setBlur(blur);
+            shadowNode->setSpread(spread);
+            shadowNode->setOffset(shadow->offset() ? shadow->offset()->toVector2D() : QVector2D{});
+            shadowNode->setColor(shadow->color().value_or(Union::Color{}).toQColor());
+        };
+
+        if (ninePatch) {
+            auto shadowNode = static_cast<NinePatchShadowNode *>(node->firstChild());
+            updateShadow(shadowNode);
+            shadowNode->update();
+        } else {
+            auto shadowNode = static_cast<RectangleShadowNode *>(node->firstChild());
+            updateShadow(shadowNode);
+            shadowNode->update();
+        }
 
         borderNode = static_cast<OutlineBorderRectangleNode *>(node->lastChild());
     } else {
@@ -47,6 +47,10 @@ private:
     QSGNode *updateShaderNode(QSGNode *node, const Union::Properties::StylePropertyGroup *style);
 
     QuickStyle *m_style = nullptr;
+    // Whether the current node renders an opaque rectangle without shaders.
+    bool m_opaque = false;
+    // Whether the current shadow node is a NinePatchShadowNode.
+    bool m_ninePatchShadow = false;
 };
 
 }
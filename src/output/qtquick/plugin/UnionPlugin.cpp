@@ -4,6 +4,8 @@
 #include "UnionPlugin.h"
 #include <QGuiApplication>
 #include <QQuickWindow>
+
+#include <ElementQuery.h>
 #include <StyleRegistry.h>
 
 UnionPlugin::UnionPlugin(QObject *parent)
@@ -25,7 +27,19 @@ void UnionPlugin::initializeEngine(QQmlEngine *, const char *)
     volatile auto registration = &qml_register_types_org_kde_union_impl;
     Q_UNUSED(registration);
 
-    Union::StyleRegistry::instance()->load();
+    auto future = Union::StyleRegistry::instance()->loadAsync();
+
+    // Resolve commonly used element chains while the rest of the application
+    // is starting up, so the first window does not need to match any rules.
+    const auto prewarmFile = qEnvironmentVariable("UNION_STYLE_PREWARM_FILE");
+    if (!prewarmFile.isEmpty()) {
+        // Continue on the main thread, as prewarm() needs to be called from there.
+        future.then(qApp, [prewarmFile](const std::shared_ptr<Union::Style> &style) {
+            if (style) {
+                Union::ElementQuery::prewarm(style, Union::ElementQuery::readChains(prewarmFile.toStdString()));
+            }
+        });
+    }
 }
 
 #include "moc_UnionPlugin.cpp"
@@ -331,7 +331,7 @@ void PositionerLayout::updatePolish()
 
     layout.size = containerItem->size();
 
-    layout.spacing = d->spacingProperty.isValid() ? d->spacingProperty.read().toReal() : layoutGroup.spacing().value_or(0.0);
+    layout.spacing = d->spacingProperty.isValid() ? d->spacingProperty.read().toReal() : layoutGroup.spacing().value_or(0.0).toPixels();
 
     if (d->paddingValid) {
         layout.padding = QMarginsF{d->leftPaddingProperty.read().toReal(),
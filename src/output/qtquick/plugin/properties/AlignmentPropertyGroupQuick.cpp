@@ -43,6 +43,10 @@ void AlignmentPropertyGroupQuick::refreshColors()
 {
 }
 
+void AlignmentPropertyGroupQuick::refreshLengths()
+{
+}
+
 QJSValue AlignmentPropertyGroupQuick::container() const
 {
     if (!m_state) {
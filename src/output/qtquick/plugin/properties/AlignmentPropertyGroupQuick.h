@@ -42,6 +42,7 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
      * \qmlproperty Union::Properties::AlignmentContainer AlignmentPropertyGroupQuick::container
@@ -45,6 +45,11 @@ void BackgroundPropertyGroupQuick::refreshColors()
     m_image->refreshColors();
 }
 
+void BackgroundPropertyGroupQuick::refreshLengths()
+{
+    m_image->refreshLengths();
+}
+
 QJSValue BackgroundPropertyGroupQuick::color() const
 {
     if (!m_state) {
@@ -55,6 +55,14 @@ void BorderPropertyGroupQuick::refreshColors()
     m_bottom->refreshColors();
 }
 
+void BorderPropertyGroupQuick::refreshLengths()
+{
+    m_left->refreshLengths();
+    m_right->refreshLengths();
+    m_top->refreshLengths();
+    m_bottom->refreshLengths();
+}
+
 LinePropertyGroupQuick *BorderPropertyGroupQuick::left() const
 {
     return m_left.get();
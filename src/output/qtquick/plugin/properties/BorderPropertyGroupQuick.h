@@ -46,6 +46,7 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
      * \qmlproperty LinePropertyGroupQuick BorderPropertyGroupQuick::left
@@ -40,6 +40,11 @@ void CornerPropertyGroupQuick::refreshColors()
 {
 }
 
+void CornerPropertyGroupQuick::refreshLengths()
+{
+    Q_EMIT radiusChanged();
+}
+
 QJSValue CornerPropertyGroupQuick::radius() const
 {
     if (!m_state) {
@@ -48,7 +53,7 @@ QJSValue CornerPropertyGroupQuick::radius() const
 
     auto value = m_state->radius();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
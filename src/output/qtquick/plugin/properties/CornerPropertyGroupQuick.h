@@ -42,9 +42,10 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
-     * \qmlproperty qreal CornerPropertyGroupQuick::radius
+     * \qmlproperty Union::Length CornerPropertyGroupQuick::radius
      *
      * Exposes CornerPropertyGroup::radius to QML.
      */
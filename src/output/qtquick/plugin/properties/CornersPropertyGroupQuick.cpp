@@ -55,6 +55,14 @@ void CornersPropertyGroupQuick::refreshColors()
     m_bottomRight->refreshColors();
 }
 
+void CornersPropertyGroupQuick::refreshLengths()
+{
+    m_topLeft->refreshLengths();
+    m_topRight->refreshLengths();
+    m_bottomLeft->refreshLengths();
+    m_bottomRight->refreshLengths();
+}
+
 CornerPropertyGroupQuick *CornersPropertyGroupQuick::topLeft() const
 {
     return m_topLeft.get();
@@ -41,6 +41,10 @@ void DisplayPropertyGroupQuick::refreshColors()
 {
 }
 
+void DisplayPropertyGroupQuick::refreshLengths()
+{
+}
+
 QJSValue DisplayPropertyGroupQuick::visible() const
 {
     if (!m_state) {
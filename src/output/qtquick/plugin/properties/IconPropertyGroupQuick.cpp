@@ -49,6 +49,13 @@ void IconPropertyGroupQuick::refreshColors()
     Q_EMIT colorChanged();
 }
 
+void IconPropertyGroupQuick::refreshLengths()
+{
+    m_alignment->refreshLengths();
+    Q_EMIT widthChanged();
+    Q_EMIT heightChanged();
+}
+
 AlignmentPropertyGroupQuick *IconPropertyGroupQuick::alignment() const
 {
     return m_alignment.get();
@@ -62,7 +69,7 @@ QJSValue IconPropertyGroupQuick::width() const
 
     auto value = m_state->width();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -76,7 +83,7 @@ QJSValue IconPropertyGroupQuick::height() const
 
     auto value = m_state->height();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -43,6 +43,7 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
      * \qmlproperty AlignmentPropertyGroupQuick IconPropertyGroupQuick::alignment
@@ -53,7 +54,7 @@ public:
     AlignmentPropertyGroupQuick *alignment() const;
 
     /*!
-     * \qmlproperty qreal IconPropertyGroupQuick::width
+     * \qmlproperty Union::Length IconPropertyGroupQuick::width
      *
      * Exposes IconPropertyGroup::width to QML.
      */
@@ -62,7 +63,7 @@ public:
     Q_SIGNAL void widthChanged();
 
     /*!
-     * \qmlproperty qreal IconPropertyGroupQuick::height
+     * \qmlproperty Union::Length IconPropertyGroupQuick::height
      *
      * Exposes IconPropertyGroup::height to QML.
      */
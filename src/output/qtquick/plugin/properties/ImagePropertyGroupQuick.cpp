@@ -47,6 +47,10 @@ void ImagePropertyGroupQuick::refreshColors()
     Q_EMIT maskColorChanged();
 }
 
+void ImagePropertyGroupQuick::refreshLengths()
+{
+}
+
 QJSValue ImagePropertyGroupQuick::source() const
 {
     if (!m_state) {
@@ -58,6 +58,17 @@ void LayoutPropertyGroupQuick::refreshColors()
     m_margins->refreshColors();
 }
 
+void LayoutPropertyGroupQuick::refreshLengths()
+{
+    m_alignment->refreshLengths();
+    Q_EMIT widthChanged();
+    Q_EMIT heightChanged();
+    Q_EMIT spacingChanged();
+    m_padding->refreshLengths();
+    m_inset->refreshLengths();
+    m_margins->refreshLengths();
+}
+
 AlignmentPropertyGroupQuick *LayoutPropertyGroupQuick::alignment() const
 {
     return m_alignment.get();
@@ -71,7 +82,7 @@ QJSValue LayoutPropertyGroupQuick::width() const
 
     auto value = m_state->width();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -85,7 +96,7 @@ QJSValue LayoutPropertyGroupQuick::height() const
 
     auto value = m_state->height();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -99,7 +110,7 @@ QJSValue LayoutPropertyGroupQuick::spacing() const
 
     auto value = m_state->spacing();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -46,6 +46,7 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
      * \qmlproperty AlignmentPropertyGroupQuick LayoutPropertyGroupQuick::alignment
@@ -56,7 +57,7 @@ public:
     AlignmentPropertyGroupQuick *alignment() const;
 
     /*!
-     * \qmlproperty qreal LayoutPropertyGroupQuick::width
+     * \qmlproperty Union::Length LayoutPropertyGroupQuick::width
      *
      * Exposes LayoutPropertyGroup::width to QML.
      */
@@ -65,7 +66,7 @@ public:
     Q_SIGNAL void widthChanged();
 
     /*!
-     * \qmlproperty qreal LayoutPropertyGroupQuick::height
+     * \qmlproperty Union::Length LayoutPropertyGroupQuick::height
      *
      * Exposes LayoutPropertyGroup::height to QML.
      */
@@ -74,7 +75,7 @@ public:
     Q_SIGNAL void heightChanged();
 
     /*!
-     * \qmlproperty qreal LayoutPropertyGroupQuick::spacing
+     * \qmlproperty Union::Length LayoutPropertyGroupQuick::spacing
      *
      * Exposes LayoutPropertyGroup::spacing to QML.
      */
@@ -43,6 +43,11 @@ void LinePropertyGroupQuick::refreshColors()
     Q_EMIT colorChanged();
 }
 
+void LinePropertyGroupQuick::refreshLengths()
+{
+    Q_EMIT sizeChanged();
+}
+
 QJSValue LinePropertyGroupQuick::size() const
 {
     if (!m_state) {
@@ -51,7 +56,7 @@ QJSValue LinePropertyGroupQuick::size() const
 
     auto value = m_state->size();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -42,9 +42,10 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
-     * \qmlproperty qreal LinePropertyGroupQuick::size
+     * \qmlproperty Union::Length LinePropertyGroupQuick::size
      *
      * Exposes LinePropertyGroup::size to QML.
      */
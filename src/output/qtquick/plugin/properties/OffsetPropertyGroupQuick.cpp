@@ -41,6 +41,12 @@ void OffsetPropertyGroupQuick::refreshColors()
 {
 }
 
+void OffsetPropertyGroupQuick::refreshLengths()
+{
+    Q_EMIT horizontalChanged();
+    Q_EMIT verticalChanged();
+}
+
 QJSValue OffsetPropertyGroupQuick::horizontal() const
 {
     if (!m_state) {
@@ -49,7 +55,7 @@ QJSValue OffsetPropertyGroupQuick::horizontal() const
 
     auto value = m_state->horizontal();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -63,7 +69,7 @@ QJSValue OffsetPropertyGroupQuick::vertical() const
 
     auto value = m_state->vertical();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -42,9 +42,10 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
-     * \qmlproperty qreal OffsetPropertyGroupQuick::horizontal
+     * \qmlproperty Union::Length OffsetPropertyGroupQuick::horizontal
      *
      * Exposes OffsetPropertyGroup::horizontal to QML.
      */
@@ -53,7 +54,7 @@ public:
     Q_SIGNAL void horizontalChanged();
 
     /*!
-     * \qmlproperty qreal OffsetPropertyGroupQuick::vertical
+     * \qmlproperty Union::Length OffsetPropertyGroupQuick::vertical
      *
      * Exposes OffsetPropertyGroup::vertical to QML.
      */
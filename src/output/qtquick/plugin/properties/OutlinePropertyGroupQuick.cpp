@@ -55,6 +55,14 @@ void OutlinePropertyGroupQuick::refreshColors()
     m_bottom->refreshColors();
 }
 
+void OutlinePropertyGroupQuick::refreshLengths()
+{
+    m_left->refreshLengths();
+    m_right->refreshLengths();
+    m_top->refreshLengths();
+    m_bottom->refreshLengths();
+}
+
 LinePropertyGroupQuick *OutlinePropertyGroupQuick::left() const
 {
     return m_left.get();
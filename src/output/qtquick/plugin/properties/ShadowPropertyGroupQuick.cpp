@@ -47,6 +47,13 @@ void ShadowPropertyGroupQuick::refreshColors()
     Q_EMIT colorChanged();
 }
 
+void ShadowPropertyGroupQuick::refreshLengths()
+{
+    m_offset->refreshLengths();
+    Q_EMIT sizeChanged();
+    Q_EMIT blurChanged();
+}
+
 OffsetPropertyGroupQuick *ShadowPropertyGroupQuick::offset() const
 {
     return m_offset.get();
@@ -74,7 +81,7 @@ QJSValue ShadowPropertyGroupQuick::size() const
 
     auto value = m_state->size();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -88,7 +95,7 @@ QJSValue ShadowPropertyGroupQuick::blur() const
 
     auto value = m_state->blur();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
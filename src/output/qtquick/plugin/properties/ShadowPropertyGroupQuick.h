@@ -43,6 +43,7 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
      * \qmlproperty OffsetPropertyGroupQuick ShadowPropertyGroupQuick::offset
@@ -62,7 +63,7 @@ public:
     Q_SIGNAL void colorChanged();
 
     /*!
-     * \qmlproperty qreal ShadowPropertyGroupQuick::size
+     * \qmlproperty Union::Length ShadowPropertyGroupQuick::size
      *
      * Exposes ShadowPropertyGroup::size to QML.
      */
@@ -71,7 +72,7 @@ public:
     Q_SIGNAL void sizeChanged();
 
     /*!
-     * \qmlproperty qreal ShadowPropertyGroupQuick::blur
+     * \qmlproperty Union::Length ShadowPropertyGroupQuick::blur
      *
      * Exposes ShadowPropertyGroup::blur to QML.
      */
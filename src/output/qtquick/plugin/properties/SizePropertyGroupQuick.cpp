@@ -43,6 +43,14 @@ void SizePropertyGroupQuick::refreshColors()
 {
 }
 
+void SizePropertyGroupQuick::refreshLengths()
+{
+    Q_EMIT leftChanged();
+    Q_EMIT rightChanged();
+    Q_EMIT topChanged();
+    Q_EMIT bottomChanged();
+}
+
 QJSValue SizePropertyGroupQuick::left() const
 {
     if (!m_state) {
@@ -51,7 +59,7 @@ QJSValue SizePropertyGroupQuick::left() const
 
     auto value = m_state->left();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -65,7 +73,7 @@ QJSValue SizePropertyGroupQuick::right() const
 
     auto value = m_state->right();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -79,7 +87,7 @@ QJSValue SizePropertyGroupQuick::top() const
 
     auto value = m_state->top();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
@@ -93,7 +101,7 @@ QJSValue SizePropertyGroupQuick::bottom() const
 
     auto value = m_state->bottom();
     if (value) {
-        return m_style->engine()->toScriptValue(value.value());
+        return m_style->engine()->toScriptValue(value.value().toPixels());
     }
 
     return QJSValue(QJSValue::UndefinedValue);
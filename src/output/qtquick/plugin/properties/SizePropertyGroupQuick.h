@@ -42,9 +42,10 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
-     * \qmlproperty qreal SizePropertyGroupQuick::left
+     * \qmlproperty Union::Length SizePropertyGroupQuick::left
      *
      * Exposes SizePropertyGroup::left to QML.
      */
@@ -53,7 +54,7 @@ public:
     Q_SIGNAL void leftChanged();
 
     /*!
-     * \qmlproperty qreal SizePropertyGroupQuick::right
+     * \qmlproperty Union::Length SizePropertyGroupQuick::right
      *
      * Exposes SizePropertyGroup::right to QML.
      */
@@ -62,7 +63,7 @@ public:
     Q_SIGNAL void rightChanged();
 
     /*!
-     * \qmlproperty qreal SizePropertyGroupQuick::top
+     * \qmlproperty Union::Length SizePropertyGroupQuick::top
      *
      * Exposes SizePropertyGroup::top to QML.
      */
@@ -71,7 +72,7 @@ public:
     Q_SIGNAL void topChanged();
 
     /*!
-     * \qmlproperty qreal SizePropertyGroupQuick::bottom
+     * \qmlproperty Union::Length SizePropertyGroupQuick::bottom
      *
      * Exposes SizePropertyGroup::bottom to QML.
      */
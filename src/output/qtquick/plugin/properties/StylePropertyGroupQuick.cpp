@@ -75,6 +75,19 @@ void StylePropertyGroupQuick::refreshColors()
     m_shadow->refreshColors();
 }
 
+void StylePropertyGroupQuick::refreshLengths()
+{
+    m_display->refreshLengths();
+    m_layout->refreshLengths();
+    m_text->refreshLengths();
+    m_icon->refreshLengths();
+    m_background->refreshLengths();
+    m_border->refreshLengths();
+    m_outline->refreshLengths();
+    m_corners->refreshLengths();
+    m_shadow->refreshLengths();
+}
+
 DisplayPropertyGroupQuick *StylePropertyGroupQuick::display() const
 {
     return m_display.get();
@@ -51,6 +51,7 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
      * \qmlproperty DisplayPropertyGroupQuick StylePropertyGroupQuick::display
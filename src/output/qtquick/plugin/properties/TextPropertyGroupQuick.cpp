@@ -48,6 +48,11 @@ void TextPropertyGroupQuick::refreshColors()
     Q_EMIT colorChanged();
 }
 
+void TextPropertyGroupQuick::refreshLengths()
+{
+    m_alignment->refreshLengths();
+}
+
 AlignmentPropertyGroupQuick *TextPropertyGroupQuick::alignment() const
 {
     return m_alignment.get();
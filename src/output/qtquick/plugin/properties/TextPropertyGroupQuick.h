@@ -43,6 +43,7 @@ public:
     Q_SIGNAL void updated();
 
     void refreshColors();
+    void refreshLengths();
 
     /*!
      * \qmlproperty AlignmentPropertyGroupQuick TextPropertyGroupQuick::alignment
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "NinePatchShadowNode.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <QQuickWindow>
+
+#include "TextureCache.h"
+
+// Evaluate a smoothstep the same way as GLSL does, except that a zero-width
+// edge results in a hard step rather than undefined behaviour.
+inline float smoothstep(float edge0, float edge1, float x)
+{
+    if (qFuzzyCompare(edge0, edge1)) {
+        return x < edge0 ? 0.0 : 1.0;
+    }
+
+    const auto t = std::clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+// See sdf_rounded_rectangle() in sdf.glsl.
+inline float sdfRoundedRectangle(const QVector2D &point, float rect, float radius)
+{
+    const auto dx = std::abs(point.x()) - rect + radius;
+    const auto dy = std::abs(point.y()) - rect + radius;
+    const auto outside = QVector2D(std::max(dx, 0.0f), std::max(dy, 0.0f)).length();
+    return std::min(std::max(dx, dy), 0.0f) + outside - radius;
+}
+
+std::size_t NinePatchShadowNode::ImageKeyHash::operator()(const ImageKey &key) const
+{
+    return qHashMulti(QHashSeed::globalSeed(), key.radius.x(), key.radius.y(), key.radius.z(), key.radius.w(), key.blur, key.spread, key.color);
+}
+
+NinePatchShadowNode::NinePatchShadowNode(QQuickWindow *window)
+    : m_window(window)
+{
+    for (auto &patch : m_patches) {
+        patch = window->createImageNode();
+        patch->setOwnsTexture(false);
+        patch->setFiltering(QSGTexture::Linear);
+        appendChildNode(patch);
+    }
+}
+
+void NinePatchShadowNode::setItemRect(const QRectF &newItemRect)
+{
+    if (newItemRect == m_itemRect) {
+        return;
+    }
+
+    m_itemRect = newItemRect;
+    m_changed = true;
+}
+
+void NinePatchShadowNode::setRadius(const QVector4D &radius)
+{
+    if (radius == m_radius) {
+        return;
+    }
+
+    m_radius = radius;
+    m_changed = true;
+}
+
+void NinePatchShadowNode::setBlur(float blur)
+{
+    if (qFuzzyCompare(blur, m_blur)) {
+        return;
+    }
+
+    m_blur = blur;
+    m_changed = true;
+}
+
+void NinePatchShadowNode::setSpread(float spread)
+{
+    if (qFuzzyCompare(spread, m_spread)) {
+        return;
+    }
+
+    m_spread = spread;
+    m_changed = true;
+}
+
+void NinePatchShadowNode::setOffset(const QVector2D &offset)
+{
+    if (offset == m_offset) {
+        return;
+    }
+
+    m_offset = offset;
+    m_changed = true;
+}
+
+void NinePatchShadowNode::setColor(const QColor &color)
+{
+    if (color == m_color) {
+        return;
+    }
+
+    m_color = color;
+    m_changed = true;
+}
+
+void NinePatchShadowNode::update()
+{
+    if (!m_changed) {
+        return;
+    }
+
+    m_changed = false;
+
+    const auto key = ImageKey{.radius = m_radius, .blur = m_blur, .spread = m_spread, .color = m_color.rgba()};
+    auto image = s_imageCache.value(key);
+    if (!image) {
+        image = createImage(m_radius, m_blur, m_spread, m_color);
+        s_imageCache.insert(key, image.value());
+    }
+
+    auto texture = TextureCache::loadTexture(m_window, image.value(), QQuickWindow::TextureCanUseAtlas);
+    if (!texture) {
+        return;
+    }
+    m_texture = texture;
+
+    const auto size = m_spread + m_blur;
+    auto r = m_itemRect.adjusted(-size, -size, size, size);
+    r.translate(m_offset.x(), m_offset.y());
+
+    // The middle row and column of the texture are stretched to cover the
+    // edges. patchSize() leaves a pixel of margin after the corners, so the
+    // pixels next to the middle ones are straight edge as well and filtering
+    // does not pick up any of the corners.
+    const auto patch = patchSize(m_radius, m_blur, m_spread);
+    const std::array<qreal, 4> x = {r.left(), r.left() + patch, r.right() - patch, r.right()};
+    const std::array<qreal, 4> y = {r.top(), r.top() + patch, r.bottom() - patch, r.bottom()};
+    const std::array<qreal, 4> source = {0.0, qreal(patch), qreal(patch + 1), qreal(patch * 2 + 1)};
+
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            auto node = m_patches[row * 3 + column];
+            node->setTexture(m_texture.get());
+            node->setRect(QRectF(QPointF(x[column], y[row]), QPointF(x[column + 1], y[row + 1])));
+            node->setSourceRect(QRectF(QPointF(source[column], source[row]), QPointF(source[column + 1], source[row + 1])));
+        }
+    }
+}
+
+bool NinePatchShadowNode::canRender(const QRectF &itemRect, const QVector4D &radius, float blur, float spread)
+{
+    const auto size = (spread + blur) * 2.0;
+    const auto textureSize = patchSize(radius, blur, spread) * 2 + 1;
+    return itemRect.width() + size >= textureSize && itemRect.height() + size >= textureSize;
+}
+
+int NinePatchShadowNode::patchSize(const QVector4D &radius, float blur, float spread)
+{
+    // A corner covers the blur outside the shadow rectangle, the corner radius
+    // and the blur inside the rectangle. The shader additionally rounds larger
+    // shadows by at most a quarter of spread and blur.
+    const auto maxRadius = std::max({radius.x(), radius.y(), radius.z(), radius.w()});
+    return int(std::ceil(blur * 2.0 + maxRadius + (spread + blur) / 4.0)) + 1;
+}
+
+QImage NinePatchShadowNode::createImage(const QVector4D &radius, float blur, float spread, const QColor &color)
+{
+    const auto size = patchSize(radius, blur, spread) * 2 + 1;
+
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+
+    // This evaluates the same distance field as rectangleshadow.frag, for a
+    // square shadow of the texture's size. Like in the shader, coordinates are
+    // normalized to -1..1 and sizes are relative to the minimum dimension.
+    const auto spreadFactor = spread / size;
+    const auto blurFactor = blur / size;
+    const auto clampedRadius = QVector4D(std::clamp(radius.x() / size * 2.0f, 0.0f, 1.0f),
+                                         std::clamp(radius.y() / size * 2.0f, 0.0f, 1.0f),
+                                         std::clamp(radius.z() / size * 2.0f, 0.0f, 1.0f),
+                                         std::clamp(radius.w() / size * 2.0f, 0.0f, 1.0f));
+
+    for (int row = 0; row < size; ++row) {
+        auto line = reinterpret_cast<QRgb *>(image.scanLine(row));
+        for (int column = 0; column < size; ++column) {
+            const auto point = QVector2D((column + 0.5f) / size * 2.0f - 1.0f, (row + 0.5f) / size * 2.0f - 1.0f);
+
+            // Radius order is bottom right, top right, bottom left, top left.
+            float cornerRadius = 0.0;
+            if (point.x() > 0.0) {
+                cornerRadius = point.y() > 0.0 ? clampedRadius.x() : clampedRadius.y();
+            } else {
+                cornerRadius = point.y() > 0.0 ? clampedRadius.z() : clampedRadius.w();
+            }
+
+            const auto sizeFactor = 0.5f * (0.05f / std::max(cornerRadius, 0.05f));
+            const auto shadowRadius = cornerRadius + (spreadFactor + blurFactor) * sizeFactor;
+
+            const auto shadow = sdfRoundedRectangle(point, 1.0f - blurFactor * 2.0f, shadowRadius);
+            const auto coverage = 1.0f - smoothstep(-blurFactor * 2.0f, blurFactor * 2.0f, shadow);
+
+            auto pixel = color;
+            pixel.setAlphaF(color.alphaF() * coverage);
+            line[column] = qPremultiply(pixel.rgba());
+        }
+    }
+
+    return image;
+}
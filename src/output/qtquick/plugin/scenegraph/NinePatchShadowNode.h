@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include <QColor>
+#include <QImage>
+#include <QSGImageNode>
+#include <QSGNode>
+#include <QVector2D>
+#include <QVector4D>
+
+#include "LruCache.h"
+
+class QQuickWindow;
+
+/*!
+ * A node that renders a rectangle shadow using a nine-patch texture.
+ *
+ * This renders the same shadow as RectangleShadowNode. Rather than evaluating
+ * the shadow's distance field for every pixel in every frame, the shadow is
+ * rendered once into a small texture containing the four corners and a single
+ * row and column for the edges. The texture is shared by all shadows with the
+ * same parameters. Each of the nine patches is a QSGImageNode created by the
+ * window, so this works with any scene graph backend, including the software
+ * renderer.
+ */
+class NinePatchShadowNode : public QSGNode
+{
+public:
+    NinePatchShadowNode(QQuickWindow *window);
+
+    /*!
+     * Set the item rect for this shadow to \p newItemRect.
+     */
+    void setItemRect(const QRectF &newItemRect);
+    /*!
+     * Set the corner radii to \p radius.
+     */
+    void setRadius(const QVector4D &radius);
+    /*!
+     * Set the blur size to \p blur.
+     */
+    void setBlur(float blur);
+    /*!
+     * Set the spread size to \p spread.
+     */
+    void setSpread(float spread);
+    /*!
+     * Set the offset to \p offset.
+     */
+    void setOffset(const QVector2D &offset);
+    /*!
+     * Set the color to \p color.
+     */
+    void setColor(const QColor &color);
+    /*!
+     * Update the texture and patches based on newly-set parameters.
+     */
+    void update();
+
+    /*!
+     * Returns whether a shadow for \p itemRect can be rendered by this node.
+     *
+     * The corners of the nine-patch cannot overlap, so items that are too small
+     * for the corners of their shadow should use RectangleShadowNode instead.
+     */
+    static bool canRender(const QRectF &itemRect, const QVector4D &radius, float blur, float spread);
+
+private:
+    // Identifies a shadow image. The size of the image follows from radius,
+    // blur and spread.
+    struct ImageKey {
+        QVector4D radius;
+        float blur = 0.0;
+        float spread = 0.0;
+        QRgb color = 0;
+
+        bool operator==(const ImageKey &other) const = default;
+    };
+
+    struct ImageKeyHash {
+        std::size_t operator()(const ImageKey &key) const;
+    };
+
+    static int patchSize(const QVector4D &radius, float blur, float spread);
+    static QImage createImage(const QVector4D &radius, float blur, float spread, const QColor &color);
+
+    bool m_changed = false;
+    QRectF m_itemRect;
+    QVector4D m_radius;
+    float m_blur = 0.0;
+    float m_spread = 0.0;
+    QVector2D m_offset;
+    QColor m_color;
+    QQuickWindow *m_window = nullptr;
+
+    std::array<QSGImageNode *, 9> m_patches;
+    std::shared_ptr<QSGTexture> m_texture;
+
+    inline static Union::LruCache<ImageKey, QImage, 64, ImageKeyHash> s_imageCache;
+};
@@ -3,7 +3,7 @@
 
 #include "OutlineBorderRectangleNode.h"
 
-#include "UniformDataStream.h"
+#include "ShaderMaterial.h"
 
 using namespace Union;
 using namespace Union::Properties;
@@ -23,10 +23,10 @@ inline QVector4D toVector4D(const T *property)
 {
     QVector4D result;
 
-    auto directionValue = [](LinePropertyGroup *line) {
+    auto directionValue = [](LinePropertyGroup *line) -> qreal {
         if (line) {
             if (line->style().value_or(Union::Properties::LineStyle::None) != Union::Properties::LineStyle::None) {
-                return line->size().value_or(0.0);
+                return line->size().value_or(0.0).toPixels();
             }
         }
         return 0.0;
@@ -99,18 +99,18 @@ OutlineBorderRectangleNode::OutlineBorderRectangleNode()
     setIndexCount(Indices.size());
 
     setUvChannels(2);
-    setExtraDataChannels(2);
+    setExtraDataChannels(VertexDataCount);
 }
 
 void OutlineBorderRectangleNode::update()
 {
-    auto shaderName = u"styledrectangle"_s;
+    uint8_t variant = StyledRectangleVariant::None;
 
     QVector4D borderSize;
     if (m_border) {
         borderSize = toVector4D(m_border);
         if (!borderSize.isNull()) {
-            shaderName += u"-border"_s;
+            variant |= StyledRectangleVariant::Border;
         }
     }
 
@@ -118,7 +118,7 @@ void OutlineBorderRectangleNode::update()
     if (m_outline) {
         outlineSize = toVector4D(m_outline);
         if (!outlineSize.isNull()) {
-            shaderName += u"-outline"_s;
+            variant |= StyledRectangleVariant::Outline;
         }
     }
 
@@ -128,20 +128,23 @@ void OutlineBorderRectangleNode::update()
 
         auto source = imageProperties->source();
         if (source.has_value()) {
-            shaderName += u"-texture"_s;
+            variant |= StyledRectangleVariant::Texture;
             if (imageProperties->flags().has_value()) {
                 if (imageProperties->flags().value().testFlag(ImageFlag::Mask)) {
-                    shaderName += u"-mask"_s;
+                    variant |= StyledRectangleVariant::Mask;
                 } else if (imageProperties->flags().value().testFlag(ImageFlag::InvertedMask)) {
-                    shaderName += u"-invertedmask"_s;
+                    variant |= StyledRectangleVariant::InvertedMask;
                 }
                 maskColor = imageProperties->maskColor().value_or(Color{}).toQColor();
             }
         }
     }
 
-    setShader(shaderName);
-    setUniformBufferSize(sizeof(float) * 40);
+    Q_ASSERT(StyledRectangleVariant::Exists[variant]);
+    setMaterialVariant(&s_materialTypes[variant]);
+    // Only the matrix and opacity are uniforms, everything else is passed as
+    // vertex data so that materials of the same variant compare equal.
+    setUniformBufferSize(ShaderMaterial::UniformBufferSize);
 
     auto aspect = m_itemRect.width() > m_itemRect.height() ? QVector2D{float(m_itemRect.width() / m_itemRect.height()), 1.0}
                                                            : QVector2D{1.0, float(m_itemRect.height() / m_itemRect.width())};
@@ -162,22 +165,24 @@ void OutlineBorderRectangleNode::update()
     }
 
     updateVertices(m_itemRect, m_radius, borderSize, outlineSize);
-    requestGeometryUpdate();
-
-    UniformDataStream stream(uniformData());
-    stream.skipMatrixOpacity();
-    stream << aspect // aspect
-           << borderSize / minDimension // border_width
-           << outlineSize / minDimension // outline_width
-           << m_radius / minDimension // radius
-           << ShaderNode::toPremultiplied(backgroundColor) // color
-           << ShaderNode::toPremultiplied(maskColor); // mask-color
 
-    markDirty(QSGNode::DirtyMaterial);
+    setExtraDataChannelData(AspectData, QVector4D(aspect, 0.0, 0.0));
+    setExtraDataChannelData(BorderWidthData, borderSize / minDimension);
+    setExtraDataChannelData(OutlineWidthData, outlineSize / minDimension);
+    setExtraDataChannelData(RadiusData, m_radius / minDimension);
+    setExtraDataChannelData(ColorData, backgroundColor);
+    setExtraDataChannelData(MaskColorData, maskColor);
+    requestGeometryUpdate();
 
     ShaderNode::update();
 }
 
+QSGMaterial *OutlineBorderRectangleNode::createMaterialVariant(QSGMaterialType *variant)
+{
+    const auto index = std::distance(s_materialTypes.data(), variant);
+    return new ShaderMaterial(variant, u"styledrectangle-"_s + QString::number(index));
+}
+
 void OutlineBorderRectangleNode::updateGeometry(QSGGeometry *geometry)
 {
     geometry->setDrawingMode(QSGGeometry::DrawingMode::DrawTriangles);
@@ -206,6 +211,14 @@ void OutlineBorderRectangleNode::updateGeometry(QSGGeometry *geometry)
         *vertexData++ = vertex.outline.greenF();
         *vertexData++ = vertex.outline.blueF();
         *vertexData++ = vertex.outline.alphaF();
+
+        for (Channel channel = AspectData; channel < VertexDataCount; ++channel) {
+            const auto data = extraDataChannelData(channel).topLeft;
+            *vertexData++ = data.x();
+            *vertexData++ = data.y();
+            *vertexData++ = data.z();
+            *vertexData++ = data.w();
+        }
     }
 
     memcpy(geometry->indexData(), Indices.data(), geometry->indexCount() * sizeof(uint16_t));
@@ -8,6 +8,7 @@
 #include <properties/OutlinePropertyGroup.h>
 
 #include "ShaderNode.h"
+#include "StyledRectangleVariant.h"
 
 class OutlineBorderRectangleNode : public ShaderNode
 {
@@ -24,9 +25,24 @@ public:
     void update() override;
 
 protected:
+    QSGMaterial *createMaterialVariant(QSGMaterialType *variant) override;
     void updateGeometry(QSGGeometry *geometry) override;
 
 private:
+    // Extra data channels used by the shader. Border and outline colors are
+    // per-vertex, the rest is the same for all vertices.
+    enum VertexData : Channel {
+        BorderColorData,
+        OutlineColorData,
+        AspectData,
+        BorderWidthData,
+        OutlineWidthData,
+        RadiusData,
+        ColorData,
+        MaskColorData,
+        VertexDataCount,
+    };
+
     struct Vertex {
         QVector2D position;
         QVector2D texture0;
@@ -41,4 +57,7 @@ private:
     void updateColors(QColor(Vertex::*destination), const QColor &left, const QColor &right, const QColor &top, const QColor &bottom, const QColor &center);
 
     std::array<Vertex, 28> m_vertices;
+
+    // One material type per shader variant, indexed by variant.
+    inline static std::array<QSGMaterialType, StyledRectangleVariant::Count> s_materialTypes;
 };
@@ -3,7 +3,7 @@
 
 #include "RectangleShadowNode.h"
 
-#include "UniformDataStream.h"
+#include "ShaderMaterial.h"
 
 using namespace Qt::StringLiterals;
 
@@ -11,8 +11,11 @@ RectangleShadowNode::RectangleShadowNode()
 {
     setShader(u"rectangleshadow"_s);
 
-    setUniformBufferSize(sizeof(float) * 32);
+    // Only the matrix and opacity are uniforms, the shadow parameters are
+    // passed as vertex data so that shadows can be batched.
+    setUniformBufferSize(ShaderMaterial::UniformBufferSize);
     setUvChannels(1);
+    setExtraDataChannels(VertexDataCount);
 }
 
 void RectangleShadowNode::setItemRect(const QRectF &newItemRect)
@@ -92,15 +95,9 @@ void RectangleShadowNode::update()
     auto aspect = r.width() > r.height() ? QVector2D{float(r.width() / r.height()), 1.0} : QVector2D{1.0, float(r.height() / r.width())};
     auto minDimension = std::min(r.width(), r.height());
 
-    UniformDataStream stream(uniformData());
-    stream.skipMatrixOpacity();
-    stream << aspect // aspect
-           << float(m_spread / minDimension) // spread
-           << float(m_blur / minDimension) // blur
-           << m_radius / minDimension // radius
-           << ShaderNode::toPremultiplied(m_color); // color
-
-    markDirty(QSGNode::DirtyMaterial);
+    setExtraDataChannelData(ShapeData, QVector4D(aspect, float(m_spread / minDimension), float(m_blur / minDimension)));
+    setExtraDataChannelData(RadiusData, m_radius / minDimension);
+    setExtraDataChannelData(ColorData, m_color);
 
     ShaderNode::update();
 }
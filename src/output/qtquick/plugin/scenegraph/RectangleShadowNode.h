@@ -56,6 +56,15 @@ public:
     void update() override;
 
 private:
+    // Extra data channels used by the shader.
+    enum VertexData : Channel {
+        // Aspect ratio in x and y, spread in z and blur in w.
+        ShapeData,
+        RadiusData,
+        ColorData,
+        VertexDataCount,
+    };
+
     bool m_changed = false;
     QRectF m_itemRect;
     QVector4D m_radius;
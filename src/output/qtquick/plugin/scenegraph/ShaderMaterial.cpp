@@ -22,6 +22,13 @@ ShaderMaterial::ShaderMaterial(QSGMaterialType *type)
     setFlag(QSGMaterial::Blending, true);
 }
 
+ShaderMaterial::ShaderMaterial(QSGMaterialType *type, const QString &name)
+    : m_name(name)
+    , m_type(type)
+{
+    setFlag(QSGMaterial::Blending, true);
+}
+
 QString ShaderMaterial::name() const
 {
     return m_name;
@@ -40,7 +47,23 @@ QSGMaterialType *ShaderMaterial::type() const
 int ShaderMaterial::compare(const QSGMaterial *other) const
 {
     auto material = static_cast<const ShaderMaterial *>(other);
-    if (m_uniformData == material->m_uniformData && m_textures == material->m_textures) {
+
+    // Textures are compared by their comparison key, so that textures from the
+    // same atlas are considered equal and nodes using them can be batched.
+    if (m_textures.size() != material->m_textures.size()) {
+        return m_textures.size() < material->m_textures.size() ? -1 : 1;
+    }
+
+    for (auto itr = m_textures.cbegin(); itr != m_textures.cend(); ++itr) {
+        auto otherTexture = material->m_textures.value(itr.key(), nullptr);
+        const auto key = itr.value() ? itr.value()->comparisonKey() : 0;
+        const auto otherKey = otherTexture ? otherTexture->comparisonKey() : 0;
+        if (key != otherKey) {
+            return key < otherKey ? -1 : 1;
+        }
+    }
+
+    if (m_uniformData == material->m_uniformData) {
         return 0;
     }
 
@@ -20,6 +20,21 @@ class ShaderMaterial : public QSGMaterial
 public:
     ShaderMaterial(const QString &name);
     ShaderMaterial(QSGMaterialType *type);
+    /**
+     * Create a material of type \p type that uses the shader \p name.
+     *
+     * This is intended for nodes that manage their own material types, which
+     * avoids looking up the type by name.
+     */
+    ShaderMaterial(QSGMaterialType *type, const QString &name);
+
+    /**
+     * The size of the uniform buffer used by the shaders, in bytes.
+     *
+     * The uniform block only contains the matrix and opacity, padded to the
+     * alignment std140 requires for the block.
+     */
+    static constexpr qsizetype UniformBufferSize = sizeof(float) * 20;
 
     QString name() const;
 
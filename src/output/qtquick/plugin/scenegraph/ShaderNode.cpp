@@ -297,6 +297,16 @@ void ShaderNode::setExtraDataChannelData(Channel channel, //
     m_geometryUpdateNeeded = true;
 }
 
+void ShaderNode::setExtraDataChannelData(Channel channel, const QVector4D &value)
+{
+    setExtraDataChannelData(channel, value, value, value, value);
+}
+
+void ShaderNode::setExtraDataChannelData(Channel channel, const QColor &color)
+{
+    setExtraDataChannelData(channel, color, color, color, color);
+}
+
 void ShaderNode::update()
 {
     if (m_geometryUpdateNeeded || m_geometryRebuildNeeded) {
@@ -402,6 +412,15 @@ void ShaderNode::updateGeometry(QSGGeometry *geometry)
     markDirty(QSGNode::DirtyGeometry);
 }
 
+ShaderNode::DataChannel ShaderNode::extraDataChannelData(Channel channel) const
+{
+    if (channel >= m_extraChannels) {
+        return DataChannel{};
+    }
+
+    return m_extraChannelData[channel];
+}
+
 void ShaderNode::preprocessTexture(const TextureInfo &info)
 {
     auto provider = info.provider;
@@ -82,9 +82,6 @@ public:
 
     /*!
      * A writeable view of the material's uniform data buffer.
-     *
-     * This can be used in combination with UniformDataStream to write the
-     * values of your uniforms.
      */
     std::span<char> uniformData();
 
@@ -192,6 +189,21 @@ public:
      */
     void setExtraDataChannelData(Channel channel, const QColor &topLeft, const QColor &topRight, const QColor &bottomLeft, const QColor &bottomRight);
 
+    /*!
+     * Set the data for all vertices of channel \p channel to \p value.
+     *
+     * This is intended for values that are the same for the entire geometry,
+     * like sizes. Using vertex data rather than uniforms for these means the
+     * material does not change when they do, so nodes using the same material
+     * variant can be batched.
+     */
+    void setExtraDataChannelData(Channel channel, const QVector4D &value);
+
+    /*!
+     * Set the data for all vertices of channel \p channel to \p color.
+     */
+    void setExtraDataChannelData(Channel channel, const QColor &color);
+
     /*!
      * Update internal state based on newly-set parameters.
      *
@@ -245,6 +257,13 @@ protected:
      * Override this if you want to change the vertex and/or index data.
      */
     virtual void updateGeometry(QSGGeometry *geometry);
+    /*!
+     * Returns the data for channel \p channel.
+     *
+     * This is intended for nodes that override updateGeometry() but still want
+     * to use extra data channels.
+     */
+    DataChannel extraDataChannelData(Channel channel) const;
 
 private:
     void preprocessTexture(const TextureInfo &texture);
@@ -54,8 +54,8 @@ void ShadowNode::update(QQuickWindow *window)
     QMarginsF offsets;
     if (m_shadow.offset().has_value()) {
         auto offsetProperty = m_shadow.offset().value();
-        auto horizontal = offsetProperty.horizontal().value_or(0.0);
-        auto vertical = offsetProperty.vertical().value_or(0.0);
+        qreal horizontal = offsetProperty.horizontal().value_or(0.0);
+        qreal vertical = offsetProperty.vertical().value_or(0.0);
 
         offsets.setLeft(horizontal < 0.0 ? std::abs(horizontal) : 0.0);
         offsets.setRight(horizontal > 0.0 ? horizontal : 0.0);
@@ -0,0 +1,310 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#include "TextureAtlas.h"
+
+#include <QPainter>
+#include <QQuickWindow>
+#include <QSGTexture>
+
+#include <rhi/qrhi.h>
+
+class TextureAtlas::Page
+{
+public:
+    Page(QQuickWindow *window)
+        : m_window(window)
+    {
+    }
+
+    ~Page()
+    {
+        releaseResources();
+    }
+
+    QQuickWindow *window() const
+    {
+        return m_window;
+    }
+
+    QRhiTexture *texture() const
+    {
+        return m_texture;
+    }
+
+    std::optional<QRect> allocate(const QSize &size)
+    {
+        for (auto &shelf : m_shelves) {
+            // Avoid wasting too much space by putting small images in a high
+            // shelf.
+            if (shelf.height < size.height() || shelf.height > size.height() * 2) {
+                continue;
+            }
+
+            // Reuse space released by an earlier image.
+            for (auto itr = shelf.released.begin(); itr != shelf.released.end(); ++itr) {
+                if (itr->width() < size.width()) {
+                    continue;
+                }
+
+                const QRect rect(itr->topLeft(), size);
+                if (itr->width() > size.width()) {
+                    itr->setLeft(itr->left() + size.width());
+                } else {
+                    shelf.released.erase(itr);
+                }
+
+                m_allocations++;
+                return rect;
+            }
+
+            if (shelf.cursor + size.width() <= PageSize) {
+                const QRect rect(QPoint(shelf.cursor, shelf.y), size);
+                shelf.cursor += size.width();
+                m_allocations++;
+                return rect;
+            }
+        }
+
+        const auto y = m_shelves.isEmpty() ? 0 : m_shelves.last().y + m_shelves.last().height;
+        if (y + size.height() > PageSize) {
+            return std::nullopt;
+        }
+
+        m_shelves.append(Shelf{.y = y, .height = size.height(), .cursor = size.width(), .released = {}});
+        m_allocations++;
+        return QRect(QPoint(0, y), size);
+    }
+
+    void release(const QRect &rect)
+    {
+        m_allocations--;
+        if (m_allocations == 0) {
+            m_shelves.clear();
+            return;
+        }
+
+        for (auto &shelf : m_shelves) {
+            if (shelf.y == rect.y()) {
+                shelf.released.append(QRect(rect.x(), rect.y(), rect.width(), shelf.height));
+                return;
+            }
+        }
+    }
+
+    void upload(const QImage &image, const QPoint &position)
+    {
+        m_pendingUploads.append(std::make_pair(image, position));
+    }
+
+    void commit(QRhi *rhi, QRhiResourceUpdateBatch *resourceUpdates)
+    {
+        // The atlas this page belonged to is gone.
+        if (!m_window) {
+            return;
+        }
+
+        if (!m_texture) {
+            m_texture = rhi->newTexture(QRhiTexture::RGBA8, QSize(PageSize, PageSize));
+            if (!m_texture->create()) {
+                delete m_texture;
+                m_texture = nullptr;
+                return;
+            }
+        }
+
+        if (m_pendingUploads.isEmpty()) {
+            return;
+        }
+
+        QVarLengthArray<QRhiTextureUploadEntry, 16> entries;
+        for (const auto &[image, position] : std::as_const(m_pendingUploads)) {
+            QRhiTextureSubresourceUploadDescription description(image);
+            description.setDestinationTopLeft(position);
+            entries.append(QRhiTextureUploadEntry(0, 0, description));
+        }
+        resourceUpdates->uploadTexture(m_texture, QRhiTextureUploadDescription(entries.cbegin(), entries.cend()));
+
+        m_pendingUploads.clear();
+    }
+
+    void releaseResources()
+    {
+        delete m_texture;
+        m_texture = nullptr;
+        m_window = nullptr;
+    }
+
+private:
+    struct Shelf {
+        int y = 0;
+        int height = 0;
+        int cursor = 0;
+        QList<QRect> released;
+    };
+
+    QQuickWindow *m_window;
+    QRhiTexture *m_texture = nullptr;
+    QList<Shelf> m_shelves;
+    int m_allocations = 0;
+    QList<std::pair<QImage, QPoint>> m_pendingUploads;
+};
+
+class AtlasTexture : public QSGTexture
+{
+public:
+    AtlasTexture(const std::shared_ptr<TextureAtlas::Page> &page, const QRect &allocation, const QImage &image)
+        : m_page(page)
+        , m_allocation(allocation)
+        , m_rect(allocation.marginsRemoved(QMargins(TextureAtlas::Padding, TextureAtlas::Padding, TextureAtlas::Padding, TextureAtlas::Padding)))
+        , m_image(image)
+    {
+    }
+
+    ~AtlasTexture() override
+    {
+        m_page->release(m_allocation);
+    }
+
+    qint64 comparisonKey() const override
+    {
+        return qint64(m_page.get());
+    }
+
+    QRhiTexture *rhiTexture() const override
+    {
+        return m_page->texture();
+    }
+
+    QSize textureSize() const override
+    {
+        return m_rect.size();
+    }
+
+    bool hasAlphaChannel() const override
+    {
+        return m_image.hasAlphaChannel();
+    }
+
+    bool hasMipmaps() const override
+    {
+        return false;
+    }
+
+    bool isAtlasTexture() const override
+    {
+        return true;
+    }
+
+    QRectF normalizedTextureSubRect() const override
+    {
+        constexpr auto pageSize = qreal(TextureAtlas::PageSize);
+        return QRectF(m_rect.x() / pageSize, m_rect.y() / pageSize, m_rect.width() / pageSize, m_rect.height() / pageSize);
+    }
+
+    QSGTexture *removedFromAtlas(QRhiResourceUpdateBatch * /*resourceUpdates*/) const override
+    {
+        if (!m_standalone && m_page->window()) {
+            m_standalone.reset(m_page->window()->createTextureFromImage(m_image));
+        }
+        return m_standalone.get();
+    }
+
+    void commitTextureOperations(QRhi *rhi, QRhiResourceUpdateBatch *resourceUpdates) override
+    {
+        m_page->commit(rhi, resourceUpdates);
+    }
+
+private:
+    std::shared_ptr<TextureAtlas::Page> m_page;
+    QRect m_allocation;
+    QRect m_rect;
+    QImage m_image;
+    mutable std::unique_ptr<QSGTexture> m_standalone;
+};
+
+TextureAtlas::TextureAtlas(QQuickWindow *window)
+    : m_window(window)
+{
+    // The textures of the pages need to be released before the window's QRhi
+    // is, so drop the atlas when the scene graph is invalidated.
+    m_invalidatedConnection = QObject::connect(
+        window,
+        &QQuickWindow::sceneGraphInvalidated,
+        window,
+        [window]() {
+            QMutexLocker locker(&s_mutex);
+            delete s_atlases.take(window);
+        },
+        Qt::DirectConnection);
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    QObject::disconnect(m_invalidatedConnection);
+
+    // Textures from the atlas may outlive it, they keep their page alive but
+    // can no longer be rendered.
+    for (const auto &page : m_pages) {
+        page->releaseResources();
+    }
+}
+
+QSGTexture *TextureAtlas::createTexture(const QImage &image)
+{
+    if (image.isNull() || image.width() > MaxImageSize || image.height() > MaxImageSize) {
+        return nullptr;
+    }
+
+    const auto size = image.size() + QSize(Padding * 2, Padding * 2);
+
+    std::shared_ptr<Page> page;
+    std::optional<QRect> allocation;
+    for (const auto &candidate : m_pages) {
+        allocation = candidate->allocate(size);
+        if (allocation) {
+            page = candidate;
+            break;
+        }
+    }
+
+    if (!allocation) {
+        if (m_pages.size() >= MaxPages) {
+            return nullptr;
+        }
+
+        page = std::make_shared<Page>(m_window);
+        allocation = page->allocate(size);
+        m_pages.push_back(page);
+    }
+
+    // Upload the padding along with the image, as the contents of the page
+    // are undefined until something is uploaded to it.
+    QImage padded(size, QImage::Format_RGBA8888_Premultiplied);
+    padded.fill(Qt::transparent);
+    QPainter painter(&padded);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.drawImage(Padding, Padding, image);
+    painter.end();
+
+    page->upload(padded, allocation->topLeft());
+
+    return new AtlasTexture(page, allocation.value(), image);
+}
+
+TextureAtlas *TextureAtlas::forWindow(QQuickWindow *window)
+{
+    if (!window || !window->rhi()) {
+        return nullptr;
+    }
+
+    QMutexLocker locker(&s_mutex);
+
+    auto atlas = s_atlases.value(window);
+    if (!atlas) {
+        atlas = new TextureAtlas(window);
+        s_atlases.insert(window, atlas);
+    }
+
+    return atlas;
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+// SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+
+class QQuickWindow;
+class QSGTexture;
+
+/*!
+ * A texture atlas for small images, shared by everything rendering into a window.
+ *
+ * Images are packed into shelves on large pages. The texture for an image
+ * refers to a part of a page, so nodes that use images from the same page end
+ * up using the same underlying texture and can be batched together. Pixels are
+ * uploaded when the renderer commits the operations of a texture.
+ *
+ * Space is released once the texture of an image is destroyed, after which it
+ * is reused for images of a similar size. Pages that no longer contain any
+ * images are reset entirely.
+ */
+class TextureAtlas
+{
+public:
+    class Page;
+
+    // The size of a single page of the atlas.
+    static constexpr int PageSize = 1024;
+    // The maximum number of pages per window.
+    static constexpr int MaxPages = 4;
+    // Images larger than this in either dimension are not put in the atlas.
+    static constexpr int MaxImageSize = 128;
+    // Transparent padding around each image, to avoid sampling from
+    // neighbouring images when using linear filtering.
+    static constexpr int Padding = 1;
+
+    explicit TextureAtlas(QQuickWindow *window);
+    ~TextureAtlas();
+
+    /*!
+     * Create a texture for \p image in the atlas.
+     *
+     * The returned texture is owned by the caller. Returns nullptr if the
+     * image is too large for the atlas or the atlas is full, in which case a
+     * regular texture should be used instead.
+     */
+    QSGTexture *createTexture(const QImage &image);
+
+    /*!
+     * Returns the atlas for \p window.
+     *
+     * Returns nullptr if \p window does not render using QRhi, for example
+     * when using the software backend.
+     */
+    static TextureAtlas *forWindow(QQuickWindow *window);
+
+private:
+    QQuickWindow *m_window;
+    std::vector<std::shared_ptr<Page>> m_pages;
+    QMetaObject::Connection m_invalidatedConnection;
+
+    inline static QMutex s_mutex;
+    inline static QHash<QQuickWindow *, TextureAtlas *> s_atlases;
+};
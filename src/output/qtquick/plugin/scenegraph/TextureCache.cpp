@@ -10,6 +10,7 @@
 
 #include <QImage>
 
+#include "TextureAtlas.h"
 #include "qtquick_logging.h"
 
 namespace fs = std::filesystem;
@@ -28,7 +29,21 @@ std::shared_ptr<QSGTexture> TextureCache::loadTexture(QQuickWindow *window, cons
             s_cache.remove(id);
             delete texture;
         };
-        texture = std::shared_ptr<QSGTexture>(window->createTextureFromImage(image, options), cleanAndDelete);
+
+        // Prefer our own atlas for small images, so things like icons and
+        // border images share a texture and can be batched.
+        QSGTexture *newTexture = nullptr;
+        if (options & QQuickWindow::TextureCanUseAtlas) {
+            if (auto atlas = TextureAtlas::forWindow(window)) {
+                newTexture = atlas->createTexture(image);
+            }
+        }
+
+        if (!newTexture) {
+            newTexture = window->createTextureFromImage(image, options);
+        }
+
+        texture = std::shared_ptr<QSGTexture>(newTexture, cleanAndDelete);
         s_cache[id] = texture;
     }
 
@@ -6,8 +6,11 @@
  *  SPDX-License-Identifier: LGPL-2.0-or-later
  */
 
+#pragma once
+
 #include <filesystem>
 
+#include <QQuickWindow>
 #include <QSGTexture>
 
 #include "LruCache.h"
@@ -32,55 +32,102 @@ endmacro()
 
 add_shaders("rectangleshadow" INPUT rectangleshadow)
 
-macro(name_to_define ARG_NAME ARG_OUTPUT)
-    if ("${ARG_NAME}" STREQUAL "border")
-        set(${ARG_OUTPUT} ENABLE_BORDER=1)
-    endif()
-    if ("${ARG_NAME}" STREQUAL "outline")
-        set(${ARG_OUTPUT} ENABLE_OUTLINE=1)
-    endif()
-    if ("${ARG_NAME}" STREQUAL "texture")
-        set(${ARG_OUTPUT} ENABLE_TEXTURE=1)
-    endif()
-    if ("${ARG_NAME}" STREQUAL "mask")
-        set(${ARG_OUTPUT} ENABLE_MASK=1)
-    endif()
-    if ("${ARG_NAME}" STREQUAL "invertedmask")
-        set(${ARG_OUTPUT} ENABLE_INVERTEDMASK=1)
-    endif()
-endmacro()
+# The features of the styledrectangle shader. Each feature is a bit of the
+# variant index, in the order listed here, and defines ENABLE_<FEATURE> when
+# compiling the shader. A shader is generated for every valid combination of
+# features, named "styledrectangle-<index>".
+set(_styledrectangle_features Border Outline Texture Mask InvertedMask)
+# Features that can only be used in combination with another feature.
+set(_styledrectangle_requires "Mask:Texture" "InvertedMask:Texture")
+# Features that cannot be combined.
+set(_styledrectangle_excludes "Mask:InvertedMask")
+
+list(LENGTH _styledrectangle_features _feature_count)
+math(EXPR _variant_count "1 << ${_feature_count}")
+math(EXPR _last_variant "${_variant_count} - 1")
+
+# Returns whether the variant with index ARG_INDEX includes ARG_FEATURE.
+function(variant_has_feature ARG_INDEX ARG_FEATURE ARG_OUTPUT)
+    list(FIND _styledrectangle_features "${ARG_FEATURE}" _bit)
+    math(EXPR _value "(${ARG_INDEX} >> ${_bit}) & 1")
+    set(${ARG_OUTPUT} ${_value} PARENT_SCOPE)
+endfunction()
+
+set(_feature_entries "")
+set(_bit 0)
+foreach(_feature ${_styledrectangle_features})
+    string(APPEND _feature_entries "    ${_feature} = 1 << ${_bit},\n")
+    math(EXPR _bit "${_bit} + 1")
+endforeach()
+
+set(_exists_entries "")
+foreach(_index RANGE ${_last_variant})
+    set(_valid TRUE)
 
-set(_variants
-    "border"
-    "border-outline"
-    "border-texture"
-    "border-outline-texture"
-    "outline"
-    "outline-texture"
-    "texture"
-    "mask"
-    "texture-mask"
-    "border-texture-mask"
-    "border-outline-texture-mask"
-    "invertedmask"
-    "texture-invertedmask"
-    "border-texture-invertedmask"
-    "border-outline-texture-invertedmask"
-)
-
-add_shaders("styledrectangle" INPUT styledrectangle)
-
-foreach(_variant ${_variants})
-    string(REPLACE "-" ";" _parts "${_variant}")
+    foreach(_rule ${_styledrectangle_requires})
+        string(REPLACE ":" ";" _rule "${_rule}")
+        list(GET _rule 0 _feature)
+        list(GET _rule 1 _required)
+        variant_has_feature(${_index} ${_feature} _has_feature)
+        variant_has_feature(${_index} ${_required} _has_required)
+        if (_has_feature AND NOT _has_required)
+            set(_valid FALSE)
+        endif()
+    endforeach()
+
+    foreach(_rule ${_styledrectangle_excludes})
+        string(REPLACE ":" ";" _rule "${_rule}")
+        list(GET _rule 0 _first)
+        list(GET _rule 1 _second)
+        variant_has_feature(${_index} ${_first} _has_first)
+        variant_has_feature(${_index} ${_second} _has_second)
+        if (_has_first AND _has_second)
+            set(_valid FALSE)
+        endif()
+    endforeach()
+
+    if (NOT _valid)
+        string(APPEND _exists_entries "    false,\n")
+        continue()
+    endif()
+    string(APPEND _exists_entries "    true,\n")
 
     set(_defines "")
-    foreach(_part ${_parts})
-        name_to_define("${_part}" _define)
-        list(APPEND _defines "${_define}")
+    foreach(_feature ${_styledrectangle_features})
+        variant_has_feature(${_index} ${_feature} _has_feature)
+        if (_has_feature)
+            string(TOUPPER "${_feature}" _define)
+            list(APPEND _defines "ENABLE_${_define}=1")
+        endif()
     endforeach()
 
-    add_shaders("styledrectangle-${_variant}"
+    add_shaders("styledrectangle-${_index}"
         INPUT styledrectangle
         DEFINES ${_defines}
     )
 endforeach()
+
+# Make the features available to C++, so selecting a variant is a matter of
+# combining feature flags.
+file(GENERATE OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/StyledRectangleVariant.h" CONTENT
+"// This file is generated by shaders.cmake, do not edit.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace StyledRectangleVariant
+{
+enum Feature : uint8_t {
+    None = 0,
+${_feature_entries}};
+
+// The number of variant indices, including those of invalid combinations.
+inline constexpr std::size_t Count = ${_variant_count};
+
+// Whether a shader exists for a variant index.
+inline constexpr std::array<bool, Count> Exists = {
+${_exists_entries}};
+}
+")
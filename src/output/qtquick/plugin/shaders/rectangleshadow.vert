@@ -3,26 +3,31 @@
 
 #version 440
 
+// The shadow parameters are passed as vertex data instead of uniforms, so that
+// shadows can be batched.
 layout(std140, binding = 0) uniform buf {
     highp mat4 matrix; // 16 components
-    mediump float opacity; // 17 components + 1 padding
-
-    mediump vec2 aspect; // 20 components
-
-    mediump float spread; // 21 components
-    mediump float blur; // 22 components + 2 padding
-    mediump vec4 radius; // 28 components
-    mediump vec4 color; // 32 components
+    mediump float opacity; // 17 components
 } ubuf;
 
 layout(location = 0) in highp vec4 in_vertex;
 layout(location = 1) in highp vec2 in_uv;
+// Aspect ratio in xy, spread in z and blur in w.
+layout(location = 2) in mediump vec4 in_shape;
+layout(location = 3) in mediump vec4 in_radius;
+layout(location = 4) in mediump vec4 in_color;
 
 layout(location = 0) out highp vec2 uv;
+layout(location = 1) out mediump vec4 shape;
+layout(location = 2) out mediump vec4 radius;
+layout(location = 3) out mediump vec4 color;
 
 out gl_PerVertex { vec4 gl_Position; };
 
 void main() {
-    uv = (-1.0 + 2.0 * in_uv) * ubuf.aspect;
+    uv = (-1.0 + 2.0 * in_uv) * in_shape.xy;
+    shape = in_shape;
+    radius = in_radius;
+    color = in_color;
     gl_Position = ubuf.matrix * in_vertex;
 }
@@ -17,10 +17,24 @@
 layout(binding = 1) uniform sampler2D textureSource;
 #endif
 
-layout(location = 0) in highp vec2 uv0;
-layout(location = 1) in mediump vec2 uv1;
-layout(location = 2) in mediump vec4 border_color;
-layout(location = 3) in mediump vec4 outline_color;
+// The position in xy and the aspect ratio in zw.
+layout(location = 0) in highp vec4 shape;
+layout(location = 1) in mediump vec4 radius;
+layout(location = 2) in mediump vec4 color;
+#ifdef ENABLE_TEXTURE
+layout(location = 3) in mediump vec2 uv1;
+#endif
+#ifdef ENABLE_BORDER
+layout(location = 4) in mediump vec4 border_color;
+layout(location = 5) in mediump vec4 border_width;
+#endif
+#ifdef ENABLE_OUTLINE
+layout(location = 6) in mediump vec4 outline_color;
+layout(location = 7) in mediump vec4 outline_width;
+#endif
+#if defined(ENABLE_MASK) || defined(ENABLE_INVERTEDMASK)
+layout(location = 8) in mediump vec4 mask_color;
+#endif
 
 layout(location = 0) out lowp vec4 out_color;
 
@@ -41,43 +55,43 @@ mediump vec4 adjusted_radius(mediump vec4 radius, mediump vec4 adjustment)
 
 void main()
 {
-    highp vec4 clamped_radius = clamp(ubuf.radius * 2.0, 0.0, 1.0);
+    highp vec4 clamped_radius = clamp(radius * 2.0, 0.0, 1.0);
 
     mediump vec4 col = vec4(0.0);
 
-    mediump vec4 rect = vec4(uv0, ubuf.aspect);
+    mediump vec4 rect = shape;
 
     highp vec4 corner_radius = clamped_radius;
 
 #ifdef ENABLE_OUTLINE
-    corner_radius = adjusted_radius(corner_radius, -ubuf.outlineWidth);
+    corner_radius = adjusted_radius(corner_radius, -outline_width);
     col = sdf_render(sdf_rounded_rectangle(rect.xy, rect.zw, corner_radius), col, outline_color);
 
-    rect = adjusted_rect(rect, ubuf.outlineWidth);
+    rect = adjusted_rect(rect, outline_width);
     corner_radius = clamped_radius;
 #endif
 
 #ifdef ENABLE_BORDER
     col = sdf_render(sdf_rounded_rectangle(rect.xy, rect.zw, corner_radius), col, border_color);
-    rect = adjusted_rect(rect, ubuf.borderWidth );
+    rect = adjusted_rect(rect, border_width);
 
     // Adjust corner radius for the amount the border makes the inner rectangle
     // smaller. Add a correction factor based on the scale of what we're
     // rendering, otherwise the corners end up being drawn slightly too small.
-    corner_radius = adjusted_radius(corner_radius, ubuf.borderWidth + fwidth(uv0.x));
+    corner_radius = adjusted_radius(corner_radius, border_width + fwidth(shape.x));
 #endif
     // Finally, render the inner rectangle.
     mediump float sdf = sdf_rounded_rectangle(rect.xy, rect.zw, corner_radius);
-    col = sdf_render(sdf, col, ubuf.color);
+    col = sdf_render(sdf, col, color);
 
 #ifdef ENABLE_TEXTURE
     // Sample the texture, then blend it on top of the background color.
     mediump vec4 texture_color = texture(textureSource, uv1);
 #ifdef ENABLE_MASK
-    texture_color = vec4(ubuf.mask_color.xyz * texture_color.a, texture_color.a);
+    texture_color = vec4(mask_color.xyz * texture_color.a, texture_color.a);
 #endif
 #ifdef ENABLE_INVERTEDMASK
-    texture_color = vec4(ubuf.mask_color.xyz * (1 - texture_color.a), (1 - texture_color.a));
+    texture_color = vec4(mask_color.xyz * (1 - texture_color.a), (1 - texture_color.a));
 #endif
     col = sdf_render(sdf, col, texture_color, texture_color.a, sdf_default_smoothing);
 #endif
@@ -11,18 +11,51 @@ layout(location = 1) in highp vec2 in_uv0;
 layout(location = 2) in mediump vec2 in_uv1;
 layout(location = 3) in mediump vec4 in_border_color;
 layout(location = 4) in mediump vec4 in_outline_color;
+layout(location = 5) in mediump vec4 in_aspect;
+layout(location = 6) in mediump vec4 in_border_width;
+layout(location = 7) in mediump vec4 in_outline_width;
+layout(location = 8) in mediump vec4 in_radius;
+layout(location = 9) in mediump vec4 in_color;
+layout(location = 10) in mediump vec4 in_mask_color;
 
-layout(location = 0) out highp vec2 uv0;
-layout(location = 1) out mediump vec2 uv1;
-layout(location = 2) out mediump vec4 border_color;
-layout(location = 3) out mediump vec4 outline_color;
+// The position in xy and the aspect ratio in zw.
+layout(location = 0) out highp vec4 shape;
+layout(location = 1) out mediump vec4 radius;
+layout(location = 2) out mediump vec4 color;
+#ifdef ENABLE_TEXTURE
+layout(location = 3) out mediump vec2 uv1;
+#endif
+#ifdef ENABLE_BORDER
+layout(location = 4) out mediump vec4 border_color;
+layout(location = 5) out mediump vec4 border_width;
+#endif
+#ifdef ENABLE_OUTLINE
+layout(location = 6) out mediump vec4 outline_color;
+layout(location = 7) out mediump vec4 outline_width;
+#endif
+#if defined(ENABLE_MASK) || defined(ENABLE_INVERTEDMASK)
+layout(location = 8) out mediump vec4 mask_color;
+#endif
 
 out gl_PerVertex { vec4 gl_Position; };
 
 void main() {
-    uv0 = (-1.0 + 2.0 * in_uv0) * ubuf.aspect;
+    shape = vec4((-1.0 + 2.0 * in_uv0) * in_aspect.xy, in_aspect.xy);
+    radius = in_radius;
+    color = in_color;
+#ifdef ENABLE_TEXTURE
     uv1 = in_uv1;
+#endif
+#ifdef ENABLE_BORDER
     border_color = in_border_color;
+    border_width = in_border_width;
+#endif
+#ifdef ENABLE_OUTLINE
     outline_color = in_outline_color;
+    outline_width = in_outline_width;
+#endif
+#if defined(ENABLE_MASK) || defined(ENABLE_INVERTEDMASK)
+    mask_color = in_mask_color;
+#endif
     gl_Position = ubuf.matrix * in_vertex;
 }
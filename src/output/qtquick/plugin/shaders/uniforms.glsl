@@ -5,15 +5,10 @@
 // float are aligned on 1 component boundaries.
 // vec2 on 2 component.
 // everything else on 4 component.
+//
+// Per-rectangle values are passed as vertex data instead of uniforms, so that
+// rectangles using the same shader variant can be batched.
 layout(std140, binding = 0) uniform buf {
     highp mat4 matrix; // 16 components
-    mediump float opacity; // 17 components + 1 padding
-
-    mediump vec2 aspect; // 20 components
-
-    mediump vec4 borderWidth; // 24 components
-    mediump vec4 outlineWidth; // 28 components
-    mediump vec4 radius; // 32 components
-    mediump vec4 color; // 36 components
-    mediump vec4 mask_color; // 40 components
+    mediump float opacity; // 17 components
 } ubuf;
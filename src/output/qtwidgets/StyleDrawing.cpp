@@ -220,16 +220,16 @@ void drawLineProperty(QPainter *painter,
 
         lineRect = QRectF{static_cast<double>(rect.x()),
                           rect.y() + borderSizes.top() + topMargin,
-                          line->size().value_or(0.0),
+                          line->size().value_or(0.0).toPixels(),
                           rect.height() - borderSizes.top() - borderSizes.bottom() - bottomMargin - topMargin};
     } break;
     case SubNodeIndex::Right: {
         const qreal topMargin = cornerRadii.topRight;
         const qreal bottomMargin = cornerRadii.bottomRight;
 
-        lineRect = QRectF{rect.x() + rect.width() - line->size().value_or(0.0),
+        lineRect = QRectF{rect.x() + rect.width() - line->size().value_or(0.0).toPixels(),
                           rect.y() + borderSizes.top() + topMargin,
-                          line->size().value_or(0.0),
+                          line->size().value_or(0.0).toPixels(),
                           rect.height() - borderSizes.top() - borderSizes.bottom() - bottomMargin - topMargin};
     } break;
     case SubNodeIndex::Top: {
@@ -239,16 +239,16 @@ void drawLineProperty(QPainter *painter,
         lineRect = QRectF{rect.x() + borderSizes.left() + leftMargin,
                           static_cast<double>(rect.y()),
                           rect.width() - borderSizes.left() - borderSizes.right() - rightMargin - leftMargin,
-                          line->size().value_or(0.0)};
+                          line->size().value_or(0.0).toPixels()};
     } break;
     case SubNodeIndex::Bottom: {
         const qreal leftMargin = cornerRadii.bottomLeft;
         const qreal rightMargin = cornerRadii.bottomRight;
 
         lineRect = QRectF{rect.x() + borderSizes.left() + leftMargin,
-                          rect.y() + rect.height() - line->size().value_or(0.0),
+                          rect.y() + rect.height() - line->size().value_or(0.0).toPixels(),
                           rect.width() - borderSizes.left() - borderSizes.right() - rightMargin - leftMargin,
-                          line->size().value_or(0.0)};
+                          line->size().value_or(0.0).toPixels()};
     } break;
     default:
         Q_UNREACHABLE();
@@ -273,7 +273,7 @@ void drawCornerProperty(QPainter *painter,
     QPainterPath path;
     QLinearGradient cornerTransition;
     const auto radius =
-        corner ? std::min<double>({static_cast<double>(rect.width()) / 2, static_cast<double>(rect.height()) / 2, corner->radius().value_or(0.0)}) : 0.0;
+        corner ? std::min<double>({static_cast<double>(rect.width()) / 2, static_cast<double>(rect.height()) / 2, corner->radius().value_or(0.0).toPixels()}) : 0.0;
     double innerRadius = 0.0;
     // Start, end, top and left assume a top-left corner being drawn clockwise which gets rotated
     double topMargin = 0.0;
@@ -18,7 +18,7 @@
 UnionStyle::UnionStyle()
     : QProxyStyle(qEnvironmentVariable("UNION_WIDGETS_BASE_STYLE", QStringLiteral("breeze")))
 {
-    Union::StyleRegistry::instance()->load();
+    Union::StyleRegistry::instance()->loadAsync();
 }
 
 void UnionStyle::drawControl(QStyle::ControlElement controlElement, const QStyleOption *option, QPainter *painter, const QWidget *widget) const
@@ -43,22 +43,8 @@ QString PlasmaPlatformPlugin::defaultInputPlugin()
 
 QString PlasmaPlatformPlugin::defaultStyleName()
 {
-    // These values should really be queries by the CSS using media queries,
-    // however those are currently unimplemented in cxx-rust-cssparser and will
-    // take some time to implement. So until that time, we switch the default
-    // style based on these values.
-    if (KRuntimePlatform::runtimePlatform().contains(u"phone"_s)) {
-        return u"breeze-mobile"_s;
-    }
-
-    if (qEnvironmentVariableIsSet("QT_QUICK_CONTROLS_MOBILE")) {
-        return u"breeze-mobile"_s;
-    }
-
-    if (qGuiApp->layoutDirection() == Qt::LayoutDirection::RightToLeft) {
-        return u"breeze-rtl"_s;
-    }
-
+    // Form factor and layout direction are handled by the style itself through
+    // conditions(), so there is only a single style to select.
     // TODO: Read from config
     return u"breeze"_s;
 }
@@ -94,6 +80,18 @@ qreal PlasmaPlatformPlugin::animationSpeedMultiplier()
     return m_animationSpeedMultiplier;
 }
 
+Union::StyleRule::Conditions PlasmaPlatformPlugin::conditions()
+{
+    auto result = Union::PlatformPlugin::conditions();
+
+    if (KRuntimePlatform::runtimePlatform().contains(u"phone"_s)) {
+        result &= ~Union::StyleRule::Conditions(Union::StyleRule::Condition::Desktop);
+        result |= Union::StyleRule::Condition::Mobile;
+    }
+
+    return result;
+}
+
 void PlasmaPlatformPlugin::setAnimationSpeedMultiplier(qreal multiplier)
 {
     if (qFuzzyCompare(multiplier, m_animationSpeedMultiplier)) {
@@ -24,6 +24,8 @@ public:
 
     qreal animationSpeedMultiplier() override;
 
+    Union::StyleRule::Conditions conditions() override;
+
 private:
     void setSmoothScroll(bool enabled);
     void setAnimationSpeedMultiplier(qreal multiplier);
@@ -257,16 +257,16 @@ QMarginsF BorderPropertyGroup::sizes() const
     QMarginsF result;
 
     if (d->left) {
-        result.setLeft(d->left->size().value_or(0.0));
+        result.setLeft(d->left->size().value_or(0.0).toPixels());
     }
     if (d->right) {
-        result.setRight(d->right->size().value_or(0.0));
+        result.setRight(d->right->size().value_or(0.0).toPixels());
     }
     if (d->top) {
-        result.setTop(d->top->size().value_or(0.0));
+        result.setTop(d->top->size().value_or(0.0).toPixels());
     }
     if (d->bottom) {
-        result.setBottom(d->bottom->size().value_or(0.0));
+        result.setBottom(d->bottom->size().value_or(0.0).toPixels());
     }
 
     return result;
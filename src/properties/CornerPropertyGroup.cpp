@@ -17,7 +17,7 @@ using namespace Qt::StringLiterals;
 class Union::Properties::CornerPropertyGroupPrivate
 {
 public:
-    std::optional<qreal> radius;
+    std::optional<Union::Length> radius;
 };
 
 CornerPropertyGroup::CornerPropertyGroup()
@@ -52,12 +52,12 @@ CornerPropertyGroup &CornerPropertyGroup::operator=(CornerPropertyGroup &&other)
     return *this;
 }
 
-std::optional<qreal> CornerPropertyGroup::radius() const
+std::optional<Union::Length> CornerPropertyGroup::radius() const
 {
     return d->radius;
 }
 
-void CornerPropertyGroup::setRadius(const std::optional<qreal> &newValue)
+void CornerPropertyGroup::setRadius(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->radius) {
         return;
@@ -80,7 +80,7 @@ bool CornerPropertyGroup::isEmpty() const
         return true;
     }
 
-    if (d->radius.has_value() && d->radius.value() != emptyValue<qreal>()) {
+    if (d->radius.has_value() && d->radius.value() != emptyValue<Union::Length>()) {
         return false;
     }
 
@@ -120,7 +120,7 @@ QString CornerPropertyGroup::toString(int indentation, ToStringFlags flags) cons
 
     out << indent(indentation, multiline, true) << "radius: ";
     if (d->radius) {
-        out << d->radius.value() << maybeNewLine;
+        out << d->radius->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
@@ -149,7 +149,7 @@ void CornerPropertyGroup::resolveProperties(const CornerPropertyGroup *source, C
 std::unique_ptr<CornerPropertyGroup> CornerPropertyGroup::empty()
 {
     auto result = std::make_unique<CornerPropertyGroup>();
-    result->d->radius = emptyValue<qreal>();
+    result->d->radius = emptyValue<Union::Length>();
     return result;
 }
 
@@ -177,7 +177,7 @@ QDataStream &operator<<(QDataStream &stream, const Union::Properties::CornerProp
 QDataStream &operator>>(QDataStream &stream, std::unique_ptr<Union::Properties::CornerPropertyGroup> &type)
 {
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setRadius(data);
     }
@@ -11,6 +11,7 @@
 #include <QDebug>
 
 
+#include "../Length.h"
 
 #include "PropertiesTypes.h"
 
@@ -64,14 +65,14 @@ public:
     /*!
         The radius of the corner.
      */
-    std::optional<qreal> radius() const;
+    std::optional<Union::Length> radius() const;
 
     /*!
      * Set the value of radius.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setRadius(const std::optional<qreal> &newValue);
+    void setRadius(const std::optional<Union::Length> &newValue);
 
     /*!
      * Returns if this property group has any value set.
@@ -257,16 +257,16 @@ CornersPropertyGroup::CornerRadii CornersPropertyGroup::radii() const
     CornerRadii result;
 
     if (d->topLeft) {
-        result.topLeft = d->topLeft->radius().value_or(0.0);
+        result.topLeft = d->topLeft->radius().value_or(0.0).toPixels();
     }
     if (d->topRight) {
-        result.topRight = d->topRight->radius().value_or(0.0);
+        result.topRight = d->topRight->radius().value_or(0.0).toPixels();
     }
     if (d->bottomLeft) {
-        result.bottomLeft = d->bottomLeft->radius().value_or(0.0);
+        result.bottomLeft = d->bottomLeft->radius().value_or(0.0).toPixels();
     }
     if (d->bottomRight) {
-        result.bottomRight = d->bottomRight->radius().value_or(0.0);
+        result.bottomRight = d->bottomRight->radius().value_or(0.0).toPixels();
     }
 
     return result;
@@ -18,8 +18,8 @@ class Union::Properties::IconPropertyGroupPrivate
 {
 public:
     std::unique_ptr<AlignmentPropertyGroup> alignment;
-    std::optional<qreal> width;
-    std::optional<qreal> height;
+    std::optional<Union::Length> width;
+    std::optional<Union::Length> height;
     std::optional<QString> name;
     std::optional<QUrl> source;
     std::optional<Union::Color> color;
@@ -78,12 +78,12 @@ void IconPropertyGroup::setAlignment(std::unique_ptr<AlignmentPropertyGroup> &&n
     d->alignment = std::move(newValue);
 }
 
-std::optional<qreal> IconPropertyGroup::width() const
+std::optional<Union::Length> IconPropertyGroup::width() const
 {
     return d->width;
 }
 
-void IconPropertyGroup::setWidth(const std::optional<qreal> &newValue)
+void IconPropertyGroup::setWidth(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->width) {
         return;
@@ -92,12 +92,12 @@ void IconPropertyGroup::setWidth(const std::optional<qreal> &newValue)
     d->width = newValue;
 }
 
-std::optional<qreal> IconPropertyGroup::height() const
+std::optional<Union::Length> IconPropertyGroup::height() const
 {
     return d->height;
 }
 
-void IconPropertyGroup::setHeight(const std::optional<qreal> &newValue)
+void IconPropertyGroup::setHeight(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->height) {
         return;
@@ -180,10 +180,10 @@ bool IconPropertyGroup::isEmpty() const
     if (d->alignment && !d->alignment->isEmpty()) {
         return false;
     }
-    if (d->width.has_value() && d->width.value() != emptyValue<qreal>()) {
+    if (d->width.has_value() && d->width.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->height.has_value() && d->height.value() != emptyValue<qreal>()) {
+    if (d->height.has_value() && d->height.value() != emptyValue<Union::Length>()) {
         return false;
     }
     if (d->name.has_value() && d->name.value() != emptyValue<QString>()) {
@@ -238,13 +238,13 @@ QString IconPropertyGroup::toString(int indentation, ToStringFlags flags) const
     }
     out << indent(indentation, multiline, false) << "width: ";
     if (d->width) {
-        out << d->width.value() << maybeNewLine;
+        out << d->width->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "height: ";
     if (d->height) {
-        out << d->height.value() << maybeNewLine;
+        out << d->height->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
@@ -310,8 +310,8 @@ std::unique_ptr<IconPropertyGroup> IconPropertyGroup::empty()
 {
     auto result = std::make_unique<IconPropertyGroup>();
     result->d->alignment = AlignmentPropertyGroup::empty();
-    result->d->width = emptyValue<qreal>();
-    result->d->height = emptyValue<qreal>();
+    result->d->width = emptyValue<Union::Length>();
+    result->d->height = emptyValue<Union::Length>();
     result->d->name = emptyValue<QString>();
     result->d->source = emptyValue<QUrl>();
     result->d->color = emptyValue<Union::Color>();
@@ -382,12 +382,12 @@ QDataStream &operator>>(QDataStream &stream, std::unique_ptr<Union::Properties::
         }
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setWidth(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setHeight(data);
     }
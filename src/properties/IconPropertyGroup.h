@@ -14,6 +14,7 @@
 #include <QUrl>
 
 #include "../Color.h"
+#include "../Length.h"
 #include "AlignmentPropertyGroup.h"
 
 #include "PropertiesTypes.h"
@@ -82,26 +83,26 @@ public:
     /*!
         The width of the icon.
      */
-    std::optional<qreal> width() const;
+    std::optional<Union::Length> width() const;
 
     /*!
      * Set the value of width.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setWidth(const std::optional<qreal> &newValue);
+    void setWidth(const std::optional<Union::Length> &newValue);
 
     /*!
         The height of the icon.
      */
-    std::optional<qreal> height() const;
+    std::optional<Union::Length> height() const;
 
     /*!
      * Set the value of height.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setHeight(const std::optional<qreal> &newValue);
+    void setHeight(const std::optional<Union::Length> &newValue);
 
     /*!
         The name of an icon of the icon theme to use for this icon.
@@ -18,9 +18,9 @@ class Union::Properties::LayoutPropertyGroupPrivate
 {
 public:
     std::unique_ptr<AlignmentPropertyGroup> alignment;
-    std::optional<qreal> width;
-    std::optional<qreal> height;
-    std::optional<qreal> spacing;
+    std::optional<Union::Length> width;
+    std::optional<Union::Length> height;
+    std::optional<Union::Length> spacing;
     std::unique_ptr<SizePropertyGroup> padding;
     std::unique_ptr<SizePropertyGroup> inset;
     std::unique_ptr<SizePropertyGroup> margins;
@@ -84,12 +84,12 @@ void LayoutPropertyGroup::setAlignment(std::unique_ptr<AlignmentPropertyGroup> &
     d->alignment = std::move(newValue);
 }
 
-std::optional<qreal> LayoutPropertyGroup::width() const
+std::optional<Union::Length> LayoutPropertyGroup::width() const
 {
     return d->width;
 }
 
-void LayoutPropertyGroup::setWidth(const std::optional<qreal> &newValue)
+void LayoutPropertyGroup::setWidth(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->width) {
         return;
@@ -98,12 +98,12 @@ void LayoutPropertyGroup::setWidth(const std::optional<qreal> &newValue)
     d->width = newValue;
 }
 
-std::optional<qreal> LayoutPropertyGroup::height() const
+std::optional<Union::Length> LayoutPropertyGroup::height() const
 {
     return d->height;
 }
 
-void LayoutPropertyGroup::setHeight(const std::optional<qreal> &newValue)
+void LayoutPropertyGroup::setHeight(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->height) {
         return;
@@ -112,12 +112,12 @@ void LayoutPropertyGroup::setHeight(const std::optional<qreal> &newValue)
     d->height = newValue;
 }
 
-std::optional<qreal> LayoutPropertyGroup::spacing() const
+std::optional<Union::Length> LayoutPropertyGroup::spacing() const
 {
     return d->spacing;
 }
 
-void LayoutPropertyGroup::setSpacing(const std::optional<qreal> &newValue)
+void LayoutPropertyGroup::setSpacing(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->spacing) {
         return;
@@ -191,13 +191,13 @@ bool LayoutPropertyGroup::isEmpty() const
     if (d->alignment && !d->alignment->isEmpty()) {
         return false;
     }
-    if (d->width.has_value() && d->width.value() != emptyValue<qreal>()) {
+    if (d->width.has_value() && d->width.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->height.has_value() && d->height.value() != emptyValue<qreal>()) {
+    if (d->height.has_value() && d->height.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->spacing.has_value() && d->spacing.value() != emptyValue<qreal>()) {
+    if (d->spacing.has_value() && d->spacing.value() != emptyValue<Union::Length>()) {
         return false;
     }
     if (d->padding && !d->padding->isEmpty()) {
@@ -252,19 +252,19 @@ QString LayoutPropertyGroup::toString(int indentation, ToStringFlags flags) cons
     }
     out << indent(indentation, multiline, false) << "width: ";
     if (d->width) {
-        out << d->width.value() << maybeNewLine;
+        out << d->width->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "height: ";
     if (d->height) {
-        out << d->height.value() << maybeNewLine;
+        out << d->height->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "spacing: ";
     if (d->spacing) {
-        out << d->spacing.value() << maybeNewLine;
+        out << d->spacing->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
@@ -342,9 +342,9 @@ std::unique_ptr<LayoutPropertyGroup> LayoutPropertyGroup::empty()
 {
     auto result = std::make_unique<LayoutPropertyGroup>();
     result->d->alignment = AlignmentPropertyGroup::empty();
-    result->d->width = emptyValue<qreal>();
-    result->d->height = emptyValue<qreal>();
-    result->d->spacing = emptyValue<qreal>();
+    result->d->width = emptyValue<Union::Length>();
+    result->d->height = emptyValue<Union::Length>();
+    result->d->spacing = emptyValue<Union::Length>();
     result->d->padding = SizePropertyGroup::empty();
     result->d->inset = SizePropertyGroup::empty();
     result->d->margins = SizePropertyGroup::empty();
@@ -449,17 +449,17 @@ QDataStream &operator>>(QDataStream &stream, std::unique_ptr<Union::Properties::
         }
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setWidth(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setHeight(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setSpacing(data);
     }
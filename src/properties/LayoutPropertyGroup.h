@@ -11,6 +11,7 @@
 #include <QDebug>
 
 
+#include "../Length.h"
 #include "AlignmentPropertyGroup.h"
 #include "SizePropertyGroup.h"
 
@@ -79,38 +80,38 @@ public:
     /*!
         The implicit (initial) width of an element.
      */
-    std::optional<qreal> width() const;
+    std::optional<Union::Length> width() const;
 
     /*!
      * Set the value of width.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setWidth(const std::optional<qreal> &newValue);
+    void setWidth(const std::optional<Union::Length> &newValue);
 
     /*!
         The implicit (initial) height of an element.
      */
-    std::optional<qreal> height() const;
+    std::optional<Union::Length> height() const;
 
     /*!
      * Set the value of height.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setHeight(const std::optional<qreal> &newValue);
+    void setHeight(const std::optional<Union::Length> &newValue);
 
     /*!
         The spacing between various elements.
      */
-    std::optional<qreal> spacing() const;
+    std::optional<Union::Length> spacing() const;
 
     /*!
      * Set the value of spacing.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setSpacing(const std::optional<qreal> &newValue);
+    void setSpacing(const std::optional<Union::Length> &newValue);
 
     /*!
      * Returns padding if set or nullptr if not.
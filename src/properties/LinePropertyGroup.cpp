@@ -17,7 +17,7 @@ using namespace Qt::StringLiterals;
 class Union::Properties::LinePropertyGroupPrivate
 {
 public:
-    std::optional<qreal> size;
+    std::optional<Union::Length> size;
     std::optional<Union::Color> color;
     std::optional<Union::Properties::LineStyle> style;
 };
@@ -58,12 +58,12 @@ LinePropertyGroup &LinePropertyGroup::operator=(LinePropertyGroup &&other)
     return *this;
 }
 
-std::optional<qreal> LinePropertyGroup::size() const
+std::optional<Union::Length> LinePropertyGroup::size() const
 {
     return d->size;
 }
 
-void LinePropertyGroup::setSize(const std::optional<qreal> &newValue)
+void LinePropertyGroup::setSize(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->size) {
         return;
@@ -120,7 +120,7 @@ bool LinePropertyGroup::isEmpty() const
         return true;
     }
 
-    if (d->size.has_value() && d->size.value() != emptyValue<qreal>()) {
+    if (d->size.has_value() && d->size.value() != emptyValue<Union::Length>()) {
         return false;
     }
     if (d->color.has_value() && d->color.value() != emptyValue<Union::Color>()) {
@@ -166,7 +166,7 @@ QString LinePropertyGroup::toString(int indentation, ToStringFlags flags) const
 
     out << indent(indentation, multiline, true) << "size: ";
     if (d->size) {
-        out << d->size.value() << maybeNewLine;
+        out << d->size->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
@@ -213,7 +213,7 @@ void LinePropertyGroup::resolveProperties(const LinePropertyGroup *source, LineP
 std::unique_ptr<LinePropertyGroup> LinePropertyGroup::empty()
 {
     auto result = std::make_unique<LinePropertyGroup>();
-    result->d->size = emptyValue<qreal>();
+    result->d->size = emptyValue<Union::Length>();
     result->d->color = emptyValue<Union::Color>();
     result->d->style = emptyValue<Union::Properties::LineStyle>();
     return result;
@@ -251,7 +251,7 @@ QDataStream &operator<<(QDataStream &stream, const Union::Properties::LineProper
 QDataStream &operator>>(QDataStream &stream, std::unique_ptr<Union::Properties::LinePropertyGroup> &type)
 {
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setSize(data);
     }
@@ -12,6 +12,7 @@
 
 
 #include "../Color.h"
+#include "../Length.h"
 
 #include "PropertiesTypes.h"
 
@@ -65,14 +66,14 @@ public:
     /*!
         The thickness of the line.
      */
-    std::optional<qreal> size() const;
+    std::optional<Union::Length> size() const;
 
     /*!
      * Set the value of size.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setSize(const std::optional<qreal> &newValue);
+    void setSize(const std::optional<Union::Length> &newValue);
 
     /*!
         The color of the line.
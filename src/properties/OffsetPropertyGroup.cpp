@@ -17,8 +17,8 @@ using namespace Qt::StringLiterals;
 class Union::Properties::OffsetPropertyGroupPrivate
 {
 public:
-    std::optional<qreal> horizontal;
-    std::optional<qreal> vertical;
+    std::optional<Union::Length> horizontal;
+    std::optional<Union::Length> vertical;
 };
 
 OffsetPropertyGroup::OffsetPropertyGroup()
@@ -55,12 +55,12 @@ OffsetPropertyGroup &OffsetPropertyGroup::operator=(OffsetPropertyGroup &&other)
     return *this;
 }
 
-std::optional<qreal> OffsetPropertyGroup::horizontal() const
+std::optional<Union::Length> OffsetPropertyGroup::horizontal() const
 {
     return d->horizontal;
 }
 
-void OffsetPropertyGroup::setHorizontal(const std::optional<qreal> &newValue)
+void OffsetPropertyGroup::setHorizontal(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->horizontal) {
         return;
@@ -69,12 +69,12 @@ void OffsetPropertyGroup::setHorizontal(const std::optional<qreal> &newValue)
     d->horizontal = newValue;
 }
 
-std::optional<qreal> OffsetPropertyGroup::vertical() const
+std::optional<Union::Length> OffsetPropertyGroup::vertical() const
 {
     return d->vertical;
 }
 
-void OffsetPropertyGroup::setVertical(const std::optional<qreal> &newValue)
+void OffsetPropertyGroup::setVertical(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->vertical) {
         return;
@@ -100,10 +100,10 @@ bool OffsetPropertyGroup::isEmpty() const
         return true;
     }
 
-    if (d->horizontal.has_value() && d->horizontal.value() != emptyValue<qreal>()) {
+    if (d->horizontal.has_value() && d->horizontal.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->vertical.has_value() && d->vertical.value() != emptyValue<qreal>()) {
+    if (d->vertical.has_value() && d->vertical.value() != emptyValue<Union::Length>()) {
         return false;
     }
 
@@ -143,13 +143,13 @@ QString OffsetPropertyGroup::toString(int indentation, ToStringFlags flags) cons
 
     out << indent(indentation, multiline, true) << "horizontal: ";
     if (d->horizontal) {
-        out << d->horizontal.value() << maybeNewLine;
+        out << d->horizontal->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "vertical: ";
     if (d->vertical) {
-        out << d->vertical.value() << maybeNewLine;
+        out << d->vertical->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
@@ -181,14 +181,14 @@ void OffsetPropertyGroup::resolveProperties(const OffsetPropertyGroup *source, O
 std::unique_ptr<OffsetPropertyGroup> OffsetPropertyGroup::empty()
 {
     auto result = std::make_unique<OffsetPropertyGroup>();
-    result->d->horizontal = emptyValue<qreal>();
-    result->d->vertical = emptyValue<qreal>();
+    result->d->horizontal = emptyValue<Union::Length>();
+    result->d->vertical = emptyValue<Union::Length>();
     return result;
 }
 
 QVector2D OffsetPropertyGroup::toVector2D() const
 {
-    return QVector2D{float(d->horizontal.value_or(0.0)), float(d->vertical.value_or(0.0))};
+    return QVector2D{float(d->horizontal.value_or(0.0).toPixels()), float(d->vertical.value_or(0.0).toPixels())};
 }
 
 bool Union::Properties::operator==(const OffsetPropertyGroup &left, const OffsetPropertyGroup &right)
@@ -219,12 +219,12 @@ QDataStream &operator<<(QDataStream &stream, const Union::Properties::OffsetProp
 QDataStream &operator>>(QDataStream &stream, std::unique_ptr<Union::Properties::OffsetPropertyGroup> &type)
 {
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setHorizontal(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setVertical(data);
     }
@@ -12,6 +12,7 @@
 
 #include <QVector2D>
 
+#include "../Length.h"
 
 #include "PropertiesTypes.h"
 
@@ -67,26 +68,26 @@ public:
     /*!
         The horizontal offset of the shadow.
      */
-    std::optional<qreal> horizontal() const;
+    std::optional<Union::Length> horizontal() const;
 
     /*!
      * Set the value of horizontal.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setHorizontal(const std::optional<qreal> &newValue);
+    void setHorizontal(const std::optional<Union::Length> &newValue);
 
     /*!
         The vertical offset of the shadow.
      */
-    std::optional<qreal> vertical() const;
+    std::optional<Union::Length> vertical() const;
 
     /*!
      * Set the value of vertical.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setVertical(const std::optional<qreal> &newValue);
+    void setVertical(const std::optional<Union::Length> &newValue);
 
     /*!
      * Returns if this property group has any value set.
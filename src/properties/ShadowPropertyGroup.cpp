@@ -19,8 +19,8 @@ class Union::Properties::ShadowPropertyGroupPrivate
 public:
     std::unique_ptr<OffsetPropertyGroup> offset;
     std::optional<Union::Color> color;
-    std::optional<qreal> size;
-    std::optional<qreal> blur;
+    std::optional<Union::Length> size;
+    std::optional<Union::Length> blur;
 };
 
 ShadowPropertyGroup::ShadowPropertyGroup()
@@ -86,12 +86,12 @@ void ShadowPropertyGroup::setColor(const std::optional<Union::Color> &newValue)
     d->color = newValue;
 }
 
-std::optional<qreal> ShadowPropertyGroup::size() const
+std::optional<Union::Length> ShadowPropertyGroup::size() const
 {
     return d->size;
 }
 
-void ShadowPropertyGroup::setSize(const std::optional<qreal> &newValue)
+void ShadowPropertyGroup::setSize(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->size) {
         return;
@@ -100,12 +100,12 @@ void ShadowPropertyGroup::setSize(const std::optional<qreal> &newValue)
     d->size = newValue;
 }
 
-std::optional<qreal> ShadowPropertyGroup::blur() const
+std::optional<Union::Length> ShadowPropertyGroup::blur() const
 {
     return d->blur;
 }
 
-void ShadowPropertyGroup::setBlur(const std::optional<qreal> &newValue)
+void ShadowPropertyGroup::setBlur(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->blur) {
         return;
@@ -143,10 +143,10 @@ bool ShadowPropertyGroup::isEmpty() const
     if (d->color.has_value() && d->color.value() != emptyValue<Union::Color>()) {
         return false;
     }
-    if (d->size.has_value() && d->size.value() != emptyValue<qreal>()) {
+    if (d->size.has_value() && d->size.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->blur.has_value() && d->blur.value() != emptyValue<qreal>()) {
+    if (d->blur.has_value() && d->blur.value() != emptyValue<Union::Length>()) {
         return false;
     }
 
@@ -198,13 +198,13 @@ QString ShadowPropertyGroup::toString(int indentation, ToStringFlags flags) cons
     }
     out << indent(indentation, multiline, false) << "size: ";
     if (d->size) {
-        out << d->size.value() << maybeNewLine;
+        out << d->size->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "blur: ";
     if (d->blur) {
-        out << d->blur.value() << maybeNewLine;
+        out << d->blur->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
@@ -247,8 +247,8 @@ std::unique_ptr<ShadowPropertyGroup> ShadowPropertyGroup::empty()
     auto result = std::make_unique<ShadowPropertyGroup>();
     result->d->offset = OffsetPropertyGroup::empty();
     result->d->color = emptyValue<Union::Color>();
-    result->d->size = emptyValue<qreal>();
-    result->d->blur = emptyValue<qreal>();
+    result->d->size = emptyValue<Union::Length>();
+    result->d->blur = emptyValue<Union::Length>();
     return result;
 }
 
@@ -313,12 +313,12 @@ QDataStream &operator>>(QDataStream &stream, std::unique_ptr<Union::Properties::
         type->setColor(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setSize(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setBlur(data);
     }
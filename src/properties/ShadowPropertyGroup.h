@@ -12,6 +12,7 @@
 
 
 #include "../Color.h"
+#include "../Length.h"
 #include "OffsetPropertyGroup.h"
 
 #include "PropertiesTypes.h"
@@ -92,28 +93,28 @@ as if the light were cast from a different angle.
     /*!
         The size of the shadow. This expands the area used for the shadow compared to the element.
      */
-    std::optional<qreal> size() const;
+    std::optional<Union::Length> size() const;
 
     /*!
      * Set the value of size.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setSize(const std::optional<qreal> &newValue);
+    void setSize(const std::optional<Union::Length> &newValue);
 
     /*!
         The amount of blur to use for the shadow. Increasing this will increase how smooth the shadow
 goes from fully transparent to the full shadow color.
 
      */
-    std::optional<qreal> blur() const;
+    std::optional<Union::Length> blur() const;
 
     /*!
      * Set the value of blur.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setBlur(const std::optional<qreal> &newValue);
+    void setBlur(const std::optional<Union::Length> &newValue);
 
     /*!
      * Returns if this property group has any value set.
@@ -17,10 +17,10 @@ using namespace Qt::StringLiterals;
 class Union::Properties::SizePropertyGroupPrivate
 {
 public:
-    std::optional<qreal> left;
-    std::optional<qreal> right;
-    std::optional<qreal> top;
-    std::optional<qreal> bottom;
+    std::optional<Union::Length> left;
+    std::optional<Union::Length> right;
+    std::optional<Union::Length> top;
+    std::optional<Union::Length> bottom;
 };
 
 SizePropertyGroup::SizePropertyGroup()
@@ -61,12 +61,12 @@ SizePropertyGroup &SizePropertyGroup::operator=(SizePropertyGroup &&other)
     return *this;
 }
 
-std::optional<qreal> SizePropertyGroup::left() const
+std::optional<Union::Length> SizePropertyGroup::left() const
 {
     return d->left;
 }
 
-void SizePropertyGroup::setLeft(const std::optional<qreal> &newValue)
+void SizePropertyGroup::setLeft(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->left) {
         return;
@@ -75,12 +75,12 @@ void SizePropertyGroup::setLeft(const std::optional<qreal> &newValue)
     d->left = newValue;
 }
 
-std::optional<qreal> SizePropertyGroup::right() const
+std::optional<Union::Length> SizePropertyGroup::right() const
 {
     return d->right;
 }
 
-void SizePropertyGroup::setRight(const std::optional<qreal> &newValue)
+void SizePropertyGroup::setRight(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->right) {
         return;
@@ -89,12 +89,12 @@ void SizePropertyGroup::setRight(const std::optional<qreal> &newValue)
     d->right = newValue;
 }
 
-std::optional<qreal> SizePropertyGroup::top() const
+std::optional<Union::Length> SizePropertyGroup::top() const
 {
     return d->top;
 }
 
-void SizePropertyGroup::setTop(const std::optional<qreal> &newValue)
+void SizePropertyGroup::setTop(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->top) {
         return;
@@ -103,12 +103,12 @@ void SizePropertyGroup::setTop(const std::optional<qreal> &newValue)
     d->top = newValue;
 }
 
-std::optional<qreal> SizePropertyGroup::bottom() const
+std::optional<Union::Length> SizePropertyGroup::bottom() const
 {
     return d->bottom;
 }
 
-void SizePropertyGroup::setBottom(const std::optional<qreal> &newValue)
+void SizePropertyGroup::setBottom(const std::optional<Union::Length> &newValue)
 {
     if (newValue == d->bottom) {
         return;
@@ -140,16 +140,16 @@ bool SizePropertyGroup::isEmpty() const
         return true;
     }
 
-    if (d->left.has_value() && d->left.value() != emptyValue<qreal>()) {
+    if (d->left.has_value() && d->left.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->right.has_value() && d->right.value() != emptyValue<qreal>()) {
+    if (d->right.has_value() && d->right.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->top.has_value() && d->top.value() != emptyValue<qreal>()) {
+    if (d->top.has_value() && d->top.value() != emptyValue<Union::Length>()) {
         return false;
     }
-    if (d->bottom.has_value() && d->bottom.value() != emptyValue<qreal>()) {
+    if (d->bottom.has_value() && d->bottom.value() != emptyValue<Union::Length>()) {
         return false;
     }
 
@@ -189,25 +189,25 @@ QString SizePropertyGroup::toString(int indentation, ToStringFlags flags) const
 
     out << indent(indentation, multiline, true) << "left: ";
     if (d->left) {
-        out << d->left.value() << maybeNewLine;
+        out << d->left->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "right: ";
     if (d->right) {
-        out << d->right.value() << maybeNewLine;
+        out << d->right->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "top: ";
     if (d->top) {
-        out << d->top.value() << maybeNewLine;
+        out << d->top->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
     out << indent(indentation, multiline, false) << "bottom: ";
     if (d->bottom) {
-        out << d->bottom.value() << maybeNewLine;
+        out << d->bottom->toString() << maybeNewLine;
     } else {
         out << empty << maybeNewLine;
     }
@@ -245,16 +245,16 @@ void SizePropertyGroup::resolveProperties(const SizePropertyGroup *source, SizeP
 std::unique_ptr<SizePropertyGroup> SizePropertyGroup::empty()
 {
     auto result = std::make_unique<SizePropertyGroup>();
-    result->d->left = emptyValue<qreal>();
-    result->d->right = emptyValue<qreal>();
-    result->d->top = emptyValue<qreal>();
-    result->d->bottom = emptyValue<qreal>();
+    result->d->left = emptyValue<Union::Length>();
+    result->d->right = emptyValue<Union::Length>();
+    result->d->top = emptyValue<Union::Length>();
+    result->d->bottom = emptyValue<Union::Length>();
     return result;
 }
 
 QMarginsF SizePropertyGroup::toMargins() const
 {
-    return QMarginsF{d->left.value_or(0.0), d->top.value_or(0.0), d->right.value_or(0.0), d->bottom.value_or(0.0)};
+    return QMarginsF{d->left.value_or(0.0).toPixels(), d->top.value_or(0.0).toPixels(), d->right.value_or(0.0).toPixels(), d->bottom.value_or(0.0).toPixels()};
 }
 
 bool Union::Properties::operator==(const SizePropertyGroup &left, const SizePropertyGroup &right)
@@ -293,22 +293,22 @@ QDataStream &operator<<(QDataStream &stream, const Union::Properties::SizeProper
 QDataStream &operator>>(QDataStream &stream, std::unique_ptr<Union::Properties::SizePropertyGroup> &type)
 {
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setLeft(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setRight(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setTop(data);
     }
     {
-        std::optional<qreal> data;
+        std::optional<Union::Length> data;
         stream >> data;
         type->setBottom(data);
     }
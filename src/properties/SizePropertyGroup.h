@@ -12,6 +12,7 @@
 
 #include <QMarginsF>
 
+#include "../Length.h"
 
 #include "PropertiesTypes.h"
 
@@ -66,50 +67,50 @@ public:
     /*!
         The size of the left side.
      */
-    std::optional<qreal> left() const;
+    std::optional<Union::Length> left() const;
 
     /*!
      * Set the value of left.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setLeft(const std::optional<qreal> &newValue);
+    void setLeft(const std::optional<Union::Length> &newValue);
 
     /*!
         The size of the right side.
      */
-    std::optional<qreal> right() const;
+    std::optional<Union::Length> right() const;
 
     /*!
      * Set the value of right.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setRight(const std::optional<qreal> &newValue);
+    void setRight(const std::optional<Union::Length> &newValue);
 
     /*!
         The size of the top side.
      */
-    std::optional<qreal> top() const;
+    std::optional<Union::Length> top() const;
 
     /*!
      * Set the value of top.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setTop(const std::optional<qreal> &newValue);
+    void setTop(const std::optional<Union::Length> &newValue);
 
     /*!
         The size of the bottom side.
      */
-    std::optional<qreal> bottom() const;
+    std::optional<Union::Length> bottom() const;
 
     /*!
      * Set the value of bottom.
      *
      * \a newValue The new value or \c{std::nullopt} to unset the value.
      */
-    void setBottom(const std::optional<qreal> &newValue);
+    void setBottom(const std::optional<Union::Length> &newValue);
 
     /*!
      * Returns if this property group has any value set.
@@ -22,6 +22,7 @@ root_directory = base_directory.parent.parent
 src_directory = root_directory / "src" / "properties"
 tests_directory = root_directory / "autotests" / "properties"
 css_input_directory = root_directory / "src" / "input" / "css" / "defaults"
+css_source_directory = root_directory / "src" / "input" / "css"
 css_docs_directory = root_directory / "doc" / "css"
 quick_output_directory = root_directory / "src" / "output" / "qtquick" / "plugin" / "properties"
 
@@ -33,6 +34,7 @@ include_patterns = [
     {"pattern": "Q", "system_include": True},
     {"pattern": "Union::Properties::", "use_include": None},
     {"pattern": "Union::Color", "use_include": "../Color.h"},
+    {"pattern": "Union::Length", "use_include": "../Length.h"},
 ]
 
 
@@ -217,6 +219,10 @@ if __name__ == "__main__":
     if css_generated_path.exists():
         css_generated_path.unlink()
 
+    css_table_generated_path = css_source_directory / "CssPropertyTable.h"
+    if css_table_generated_path.exists():
+        css_table_generated_path.unlink()
+
     css_doc_generated_path = css_docs_directory / "css-properties.qdoc"
     if css_doc_generated_path.exists():
         css_doc_generated_path.unlink()
@@ -247,4 +253,5 @@ if __name__ == "__main__":
     render_template("CMakeLists.txt.j2", quick_output_directory / "CMakeLists.txt", jinja_env, {"target_name": "UnionQuickImpl", "file_suffix": "Quick"} | data)
 
     render_template("properties.css.j2", css_generated_path, jinja_env, data)
+    render_template("css-property-table.h.j2", css_table_generated_path, jinja_env, data)
     render_template("css-properties.qdoc.j2", css_doc_generated_path, jinja_env, data)
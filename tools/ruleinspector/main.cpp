@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
 // SPDX-FileCopyrightText: 2024 Arjen Hiemstra <ahiemstra@heimr.nl>
 
+#include <filesystem>
 #include <iostream>
 
 #include <QCommandLineParser>
+#include <QElapsedTimer>
 #include <QGuiApplication>
 #include <QMetaEnum>
 #include <QMetaObject>
@@ -48,6 +50,8 @@ int main(int argc, char **argv)
         {u"hint"_s, u"The hint to match. Can be specified multiple times per element."_s, u"hint"_s},
         {u"attribute"_s, u"An attribute and value to match, specified as \"key=value\". Can be specified multiple times per element."_s, u"attribute"_s},
         {u"child"_s, u"Indicates that the following arguments apply to a new element."_s},
+        {u"record"_s, u"Append the element chain to a file that can be used for prewarming."_s, u"file"_s},
+        {u"prewarm"_s, u"Prewarm the query cache with the element chains from a file and report how long it took."_s, u"file"_s},
     });
 
     parser.process(app.arguments());
@@ -71,6 +75,22 @@ int main(int argc, char **argv)
         return 1;
     }
 
+    if (parser.isSet(u"prewarm"_s)) {
+        const auto chains = Union::ElementQuery::readChains(parser.value(u"prewarm"_s).toStdString());
+
+        QElapsedTimer timer;
+        timer.start();
+
+        auto future = Union::ElementQuery::prewarm(style, chains);
+        future.then(&app, [&app]() {
+            app.quit();
+        });
+        app.exec();
+
+        std::cout << "Prewarmed " << chains.size() << " element chains in " << timer.elapsed() << "ms\n";
+        return 0;
+    }
+
     Union::ElementQuery query(style);
 
     Union::ElementList elements;
@@ -124,6 +144,24 @@ int main(int argc, char **argv)
     }
     appendElement();
 
+    if (parser.isSet(u"record"_s)) {
+        const auto path = std::filesystem::path(parser.value(u"record"_s).toStdString());
+
+        QList<Union::ElementList> chains;
+        if (std::filesystem::exists(path)) {
+            chains = Union::ElementQuery::readChains(path);
+        }
+        chains.append(elements);
+
+        if (!Union::ElementQuery::writeChains(path, chains)) {
+            std::cout << "Could not write element chains to " << path.string() << "\n";
+            return 1;
+        }
+
+        std::cout << "Recorded element chain, " << path.string() << " now contains " << chains.size() << " chains\n";
+        return 0;
+    }
+
     query.setElements(elements);
     query.execute();
 